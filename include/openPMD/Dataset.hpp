@@ -57,6 +57,8 @@ public:
     Datatype dtype;
     uint8_t rank;
     Extent chunkSize;
+    //! whether chunkSize has been set by setChunkSize() or is the default
+    bool chunkSizeSpecified = false;
     std::string compression;
     std::string transform;
     std::string options = "{}"; //!< backend-dependent JSON configuration
@@ -23,7 +23,9 @@
 #include "openPMD/config.hpp"
 #include "openPMD/IO/Access.hpp"
 #include "openPMD/IO/Format.hpp"
+#include "openPMD/IO/IOStatistics.hpp"
 #include "openPMD/IO/IOTask.hpp"
+#include "openPMD/IO/IOTracer.hpp"
 
 #if openPMD_HAVE_MPI
 #   include <mpi.h>
@@ -127,6 +129,53 @@ public:
      */
     virtual std::future< void > flush() = 0;
 
+    /** Block until all operations that a previous flush() left running in
+     *  the background have completed.
+     *
+     * Handlers that flush synchronously have nothing to wait for.
+     * Errors that occurred in the background are rethrown from here.
+     */
+    virtual void awaitPendingFlush()
+    { }
+
+    /** Report errors of the operations that the last flush() left running
+     *  in the background only through the future it returned, not again
+     *  from awaitPendingFlush().
+     *
+     * To be called by callers that pass this future on to be consumed.
+     */
+    virtual void forwardErrorsToFuture()
+    { }
+
+    /** Per-Operation count, time and bytes of all tasks performed so far.
+     *
+     * Handlers that run tasks in the background wait for them first.
+     */
+    virtual IOStatistics statistics() const
+    {
+        return m_statistics;
+    }
+
+    /** Whether tasks may be processed on a thread other than the one
+     *  that enqueues them, as done for asynchronous flushing.
+     *
+     * Backends must not return true if they share unsynchronized state
+     * with other handlers or with the calling thread, e.g. a library that
+     * is not thread-safe.
+     */
+    virtual bool supportsBackgroundFlush() const
+    {
+        return false;
+    }
+
+    /** Whether the backend implements Operation::PREFETCH_FILES, i.e.
+     *  loads announced files concurrently ahead of opening them.
+     */
+    virtual bool supportsPrefetch() const
+    {
+        return false;
+    }
+
     /** The currently used backend */
     virtual std::string backendName() const = 0;
 
@@ -135,6 +184,9 @@ public:
     Access const m_frontendAccess;
     std::queue< IOTask > m_work;
     FlushLevel m_flushLevel = FlushLevel::InternalFlush;
+    IOStatistics m_statistics;
+    //! records a timeline of all tasks if set
+    std::shared_ptr< IOTracer > m_tracer;
 }; // AbstractIOHandler
 
 } // namespace openPMD
@@ -24,7 +24,14 @@
 #include "openPMD/IO/IOTask.hpp"
 #include "openPMD/auxiliary/DerefDynamicCast.hpp"
 
+#include <chrono>
+#include <cstdint>
 #include <future>
+#include <map>
+#include <memory>
+#include <queue>
+#include <utility>
+#include <vector>
 
 
 namespace openPMD
@@ -32,6 +39,44 @@ namespace openPMD
 // class AbstractIOHandler;
 class Writable;
 
+namespace internal
+{
+    /** A READ_DATASET task merged from several ones.
+     *
+     * The merged task reads into a scratch buffer, which is copied into the
+     * buffers of the original tasks by scatter() once the read has
+     * completed successfully.
+     */
+    struct CoalescedRead
+    {
+        std::shared_ptr< char > scratch;
+        //! buffers of the original tasks and their sizes in bytes
+        std::vector< std::pair< std::shared_ptr< void >, size_t > > targets;
+
+        void scatter() const;
+    };
+    //! keyed by the parameter of the merged task
+    using CoalescedReads = std::map< AbstractParameter const *, CoalescedRead >;
+
+    /** Merge runs of consecutive WRITE_DATASET (or READ_DATASET) tasks.
+     *
+     * Tasks are merged if they operate on the same Writable with the same
+     * datatype and their hyperslabs continue each other such that the
+     * row-major buffer of the union is the concatenation of their buffers,
+     * e.g. neighbouring rows of a 2D dataset.
+     * Writes are packed into one buffer. Reads are only merged if reads is
+     * given, each merged read is stored there to be scattered back after
+     * the backend has performed it. Runs are capped in size to bound the
+     * additional memory.
+     */
+    void coalesceDatasetTasks(
+        std::queue< IOTask > &, CoalescedReads * reads = nullptr );
+
+    /** Payload of a dataset read or write in bytes, zero for other tasks.
+     */
+    uint64_t payloadBytes( IOTask const & );
+} // namespace internal
+
 class AbstractIOHandlerImpl
 {
 public:
@@ -45,9 +90,14 @@ public:
     {
         using namespace auxiliary;
 
+        internal::CoalescedReads coalescedReads;
+        internal::coalesceDatasetTasks(
+            (*m_handler).m_work,
+            m_coalesceReads ? &coalescedReads : nullptr );
         while( !(*m_handler).m_work.empty() )
         {
             IOTask& i = (*m_handler).m_work.front();
+            auto const start = std::chrono::steady_clock::now();
             try
             {
                 switch( i.operation )
@@ -83,6 +133,9 @@ public:
                     case O::DELETE_FILE:
                         deleteFile(i.writable, deref_dynamic_cast< Parameter< O::DELETE_FILE > >(i.parameter.get()));
                         break;
+                    case O::PREFETCH_FILES:
+                        prefetchFiles(i.writable, deref_dynamic_cast< Parameter< O::PREFETCH_FILES > >(i.parameter.get()));
+                        break;
                     case O::DELETE_PATH:
                         deletePath(i.writable, deref_dynamic_cast< Parameter< O::DELETE_PATH > >(i.parameter.get()));
                         break;
@@ -99,8 +152,16 @@ public:
                         writeAttribute(i.writable, deref_dynamic_cast< Parameter< O::WRITE_ATT > >(i.parameter.get()));
                         break;
                     case O::READ_DATASET:
+                    {
                         readDataset(i.writable, deref_dynamic_cast< Parameter< O::READ_DATASET > >(i.parameter.get()));
+                        auto merged = coalescedReads.find( i.parameter.get() );
+                        if( merged != coalescedReads.end() )
+                        {
+                            merged->second.scatter();
+                            coalescedReads.erase( merged );
+                        }
                         break;
+                    }
                     case O::GET_BUFFER_VIEW:
                         getBufferView(i.writable, deref_dynamic_cast< Parameter< O::GET_BUFFER_VIEW > >(i.parameter.get()));
                         break;
@@ -116,6 +177,9 @@ public:
                     case O::LIST_ATTS:
                         listAttributes(i.writable, deref_dynamic_cast< Parameter< O::LIST_ATTS > >(i.parameter.get()));
                         break;
+                    case O::READ_ATTS:
+                        readAttributes(i.writable, deref_dynamic_cast< Parameter< O::READ_ATTS > >(i.parameter.get()));
+                        break;
                     case O::ADVANCE:
                         advance(i.writable, deref_dynamic_cast< Parameter< O::ADVANCE > >(i.parameter.get()));
                         break;
@@ -128,6 +192,14 @@ public:
                 (*m_handler).m_work.pop();
                 throw;
             }
+            auto const end = std::chrono::steady_clock::now();
+            (*m_handler).m_statistics.record(
+                i.operation,
+                std::chrono::duration_cast< std::chrono::nanoseconds >(
+                    end - start ),
+                internal::payloadBytes( i ) );
+            if( (*m_handler).m_tracer )
+                (*m_handler).m_tracer->recordTask( i, start, end );
             (*m_handler).m_work.pop();
         }
         return std::future< void >();
@@ -211,7 +283,7 @@ public:
    * The new dataset should be of datatype parameters.dtype.
    * The new dataset should have an extent of parameters.extent.
    * If possible, the new dataset should be extensible.
-   * If possible, the new dataset should be divided into chunks with size parameters.chunkSize.
+   * If possible and parameters.chunkSizeSpecified is set, the new dataset should be divided into chunks with size parameters.chunkSize.
    * If possible, the new dataset should be compressed according to parameters.compression. This may be format-specific.
    * If possible, the new dataset should be transformed accoring to parameters.transform. This may be format-specific.
    * The Writables file position should correspond to the newly created dataset.
@@ -267,6 +339,14 @@ public:
    * The Writable should be marked not written when the operation completes successfully.
    */
   virtual void deleteFile(Writable*, Parameter< Operation::DELETE_FILE > const&) = 0;
+  /** Announce files that will be opened for reading subsequently.
+   *
+   * The files parameters.names are given in the order in which they will be opened via Operation::OPEN_FILE, with the same naming conventions.
+   * Backends may start loading them ahead of time, using up to parameters.threads threads concurrently.
+   * Opening a file must yield the same results with or without this operation, also if the file is never opened or opened out of order.
+   * The default implementation does nothing.
+   */
+  virtual void prefetchFiles(Writable*, Parameter< Operation::PREFETCH_FILES > const&);
   /** Delete all objects within an existing path.
    *
    * The operation should fail if m_handler->m_frontendAccess is Access::READ_ONLY.
@@ -381,7 +461,27 @@ public:
    * The list of attribute names should be stored in the location indicated by the pointer parameters.attributes.
    */
   virtual void listAttributes(Writable*, Parameter< Operation::LIST_ATTS > &) = 0;
+  /** Read all attributes associated with an object.
+   *
+   * The operation should fail if the Writable was not marked written.
+   * Name, datatype and value of every attribute should be stored in the
+   * location indicated by the pointer parameters.attributes.
+   * Attributes that cannot be represented (i.e. readAttribute() would throw
+   * an unsupported_data_error) should be skipped and their names stored
+   * along with a reason in the location indicated by parameters.skipped.
+   * The default implementation combines listAttributes() and
+   * readAttribute(), backends may implement this more efficiently.
+   */
+  virtual void readAttributes(Writable*, Parameter< Operation::READ_ATTS > &);
 
   AbstractIOHandler* m_handler;
+
+protected:
+  /*
+   * Merge neighbouring READ_DATASET tasks in flush().
+   * Only valid for backends whose readDataset() has filled the buffer upon
+   * returning, backends that perform reads later must disable this.
+   */
+  bool m_coalesceReads = true;
 };  //AbstractIOHandlerImpl
 } // openPMD
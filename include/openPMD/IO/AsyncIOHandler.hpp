@@ -0,0 +1,95 @@
+/* Copyright 2021 The openPMD Community
+ *
+ * This file is part of openPMD-api.
+ *
+ * openPMD-api is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openPMD-api is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with openPMD-api.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "openPMD/IO/AbstractIOHandler.hpp"
+
+#include <condition_variable>
+#include <exception>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+namespace openPMD
+{
+    /** Decorator that flushes a backend handler on a dedicated worker thread.
+     *
+     * The frontend enqueues into this handler's own queue, so enqueueing
+     * never races with the worker. Upon flush(), all tasks whose results the
+     * frontend may inspect directly afterwards (file positions, read
+     * buffers, listings, ...) are executed synchronously in the backend.
+     * WRITE_DATASET tasks are moved behind them as far as this does not
+     * cross a structural barrier and, together with a trailing sequence of
+     * WRITE_ATT, CLOSE_PATH and CLOSE_FILE tasks, are handed to the worker.
+     * The returned future becomes ready once the backend has processed them.
+     * A flush() without new tasks returns a future for the outcome of the
+     * previous one instead of waiting for it.
+     *
+     * Buffers passed to the backend stay alive through the shared pointers
+     * inside Parameter< Operation::WRITE_DATASET >, the contents must not be
+     * modified until the flush has completed.
+     * Any subsequent flush() (and awaitPendingFlush()) waits for the
+     * background operations to finish and rethrows their errors, unless
+     * forwardErrorsToFuture() has handed them to the returned future.
+     */
+    class AsyncIOHandler : public AbstractIOHandler
+    {
+    public:
+        explicit AsyncIOHandler( std::shared_ptr< AbstractIOHandler > backend );
+        ~AsyncIOHandler() override;
+
+        std::future< void > flush() override;
+        void awaitPendingFlush() override;
+        void forwardErrorsToFuture() override;
+        IOStatistics statistics() const override;
+
+        bool supportsPrefetch() const override;
+
+        std::string backendName() const override;
+
+    private:
+        /** Run tasks in the backend on the calling thread. */
+        void process( std::queue< IOTask > tasks, FlushLevel );
+        void workerLoop();
+
+        std::shared_ptr< AbstractIOHandler > m_backend;
+
+        mutable std::mutex m_mutex;
+        std::condition_variable m_wakeWorker;
+        mutable std::condition_variable m_jobDone;
+        std::queue< IOTask > m_deferred;
+        FlushLevel m_deferredFlushLevel = FlushLevel::InternalFlush;
+        //! fulfilled once the running flush completes
+        std::vector< std::promise< void > > m_deferredPromises;
+        bool m_busy = false;
+        bool m_shutdown = false;
+        //! errors of the running flush go to its future only
+        bool m_errorForwarded = false;
+        std::exception_ptr m_error;
+
+        std::thread m_worker;
+    }; // AsyncIOHandler
+} // namespace openPMD
@@ -50,7 +50,12 @@ namespace openPMD
     hid_t
     getH5DataSpace(Attribute const& att);
 
-    std::string
+    /** Full path of the object within its HDF5 file.
+     *
+     * Cached in the HDF5FilePosition of the Writable, so repeated calls
+     * for the same object are O(1) until a position is replaced.
+     */
+    std::string const &
     concrete_h5_file_position(Writable* w);
 
     /** Computes the chunk dimensions for a dataset.
@@ -22,6 +22,10 @@
 
 #include "openPMD/IO/AbstractFilePosition.hpp"
 
+#include <atomic>
+#include <cstdint>
+#include <string>
+
 
 namespace openPMD
 {
@@ -31,6 +35,21 @@ struct HDF5FilePosition : public AbstractFilePosition
             : location{s}
     { }
 
+    //! path relative to the parent's position
     std::string location;
+    //! full path within the file, empty until concrete_h5_file_position()
+    std::string path;
+    //! value of generation when path was resolved
+    uint64_t pathGeneration = 0;
+
+    /** Number of positions replaced or removed so far.
+     *
+     * Replacing the position of an object moves all objects below it, so a
+     * cached path is only valid as long as no position has been replaced
+     * since.
+     * Assigning the first position to an object does not invalidate
+     * anything, since objects below it cannot have resolved a path yet.
+     */
+    static std::atomic< uint64_t > generation;
 };  //HDF5FilePosition
 } // openPMD
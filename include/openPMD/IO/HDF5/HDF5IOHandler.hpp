@@ -41,6 +41,9 @@ public:
 
     std::string backendName() const override { return "HDF5"; }
 
+    //! only if the HDF5 library has been built thread-safe
+    bool supportsBackgroundFlush() const override;
+
     std::future< void > flush() override;
 
 private:
@@ -23,13 +23,20 @@
 #include "openPMD/config.hpp"
 #if openPMD_HAVE_HDF5
 #   include "openPMD/IO/AbstractIOHandlerImpl.hpp"
+#   include "openPMD/IO/HDF5/HDF5FilePosition.hpp"
 
 #   include "openPMD/auxiliary/JSON.hpp"
 #   include "openPMD/auxiliary/Option.hpp"
 
 #   include <hdf5.h>
+#   include <list>
+#   include <map>
+#   include <memory>
+#   include <string>
 #   include <unordered_map>
 #   include <unordered_set>
+#   include <utility>
+#   include <vector>
 #endif
 
 
@@ -42,6 +49,8 @@ namespace openPMD
         HDF5IOHandlerImpl(AbstractIOHandler*, nlohmann::json config);
         ~HDF5IOHandlerImpl() override;
 
+        std::future< void > flush() override;
+
         void createFile(Writable*, Parameter< Operation::CREATE_FILE > const&) override;
         void createPath(Writable*, Parameter< Operation::CREATE_PATH > const&) override;
         void createDataset(Writable*, Parameter< Operation::CREATE_DATASET > const&) override;
@@ -59,6 +68,7 @@ namespace openPMD
         void writeAttribute(Writable*, Parameter< Operation::WRITE_ATT > const&) override;
         void readDataset(Writable*, Parameter< Operation::READ_DATASET > &) override;
         void readAttribute(Writable*, Parameter< Operation::READ_ATT > &) override;
+        void readAttributes(Writable*, Parameter< Operation::READ_ATTS > &) override;
         void listPaths(Writable*, Parameter< Operation::LIST_PATHS > &) override;
         void listDatasets(Writable*, Parameter< Operation::LIST_DATASETS > &) override;
         void listAttributes(Writable*, Parameter< Operation::LIST_ATTS > &) override;
@@ -77,15 +87,138 @@ namespace openPMD
         hid_t m_H5T_CDOUBLE;
         hid_t m_H5T_CLONG_DOUBLE;
 
+    protected:
+        /** Close the cached object handles within a file.
+         *
+         * Must be called before closing the file.
+         *
+         * @param file File ID, a negative value closes the handles of all
+         *             files.
+         */
+        void closeHandles( hid_t file );
+
+        /*
+         * Write blocks that are aligned with the chunks of a dataset via
+         * H5Dwrite_chunk, see writeChunksDirectly().
+         * Configured by hdf5.direct_chunk_write.
+         */
+        bool m_directChunkWrite = false;
+
     private:
         auxiliary::TracingJSON m_config;
+
+        /** Decode an opened attribute.
+         *
+         * @param location Path of the object holding the attribute, for
+         *                 error messages.
+         * @throws unsupported_data_error if the attribute has a type that
+         *         openPMD can not represent.
+         */
+        Attribute readAttributeValue(
+            hid_t attr_id,
+            std::string const & attr_name,
+            std::string const & location );
         std::string m_chunks = "auto";
+
+        /*
+         * An HDF5 filter (e.g. compression) as configured via
+         * hdf5.dataset.filters, applied in order of configuration.
+         */
+        struct Filter
+        {
+            H5Z_filter_t id;
+            std::string name;
+            unsigned flags; //!< H5Z_FLAG_MANDATORY or H5Z_FLAG_OPTIONAL
+            std::vector< unsigned > parameters; //!< client data values
+        };
+        //! filters from the global configuration
+        std::vector< Filter > m_filters;
+
+        /** Read the filters from the dataset configuration.
+         *
+         * @param datasetConfig The content of hdf5.dataset.
+         * @return Nothing if the configuration contains no filters.
+         * @throws std::runtime_error if a filter is unknown or not available
+         *         for encoding.
+         */
+        static auxiliary::Option< std::vector< Filter > >
+        getFilters( auxiliary::TracingJSON datasetConfig );
+
+        // number of threads filtering chunks for direct chunk writes,
+        // configured by hdf5.compression_threads, 0 uses one per core
+        unsigned m_compressionThreads = 1;
+
+        /** Write a block by filtering its chunks on up to
+         *  m_compressionThreads threads and passing them to H5Dwrite_chunk,
+         *  bypassing the filter pipeline of HDF5 that runs on one thread.
+         *
+         * The resulting chunks are the same as written by H5Dwrite, so that
+         * the file is readable by any HDF5 application.
+         *
+         * @param dataset The open dataset.
+         * @param dataType The HDF5 datatype of the data in memory.
+         * @param parameters The write task.
+         * @return false if the block cannot be written directly, i.e. if
+         *         direct chunk writes are disabled, the block does not cover
+         *         whole chunks, the datatypes in file and memory differ or
+         *         the dataset uses filters other than shuffle and deflate.
+         *         Nothing has been written in that case.
+         */
+        bool writeChunksDirectly(
+            hid_t dataset,
+            hid_t dataType,
+            Parameter< Operation::WRITE_DATASET > const & parameters );
         struct File
         {
             std::string name;
             hid_t id;
         };
         auxiliary::Option< File > getFile( Writable * );
+
+        /*
+         * Open object handles, so that consecutive tasks on the same object
+         * do not re-open it, which would walk the group B-trees of the file
+         * each time.
+         * Keyed by file ID and path within the file, since Writables may be
+         * destroyed and their addresses reused.
+         * Beyond m_handleCacheSize, the least recently used ones are closed.
+         * Handles are kept across flushes, see flushHandles().
+         */
+        using HandleKey = std::pair< hid_t, std::string >;
+        struct CachedHandle
+        {
+            hid_t id;
+            std::list< HandleKey >::iterator lruPosition;
+        };
+        std::map< HandleKey, CachedHandle > m_handles;
+        // most recently used first
+        std::list< HandleKey > m_handleLRU;
+        size_t m_handleCacheSize = 32;
+
+        /** Replace the file position of a Writable, or remove it if null.
+         *
+         * Invalidates the paths that concrete_h5_file_position() has cached
+         * for its descendants, see HDF5FilePosition::generation.
+         */
+        void setFilePosition(
+            Writable *, std::shared_ptr< HDF5FilePosition > position );
+
+        /** Open the object at the given path within the file, or return its
+         *  cached handle.
+         *
+         * The handle is owned by the cache and must not be closed.
+         * It stays valid until the next call.
+         */
+        hid_t obtainHandle( hid_t file, std::string const & path );
+
+        /** Write out the chunk caches of the cached dataset handles in
+         *  writable files, or close all cached handles if the cache is
+         *  disabled. Called at the end of each flush.
+         *
+         * Before HDF5 1.10, dataset handles in writable files are closed
+         * instead.
+         */
+        void flushHandles();
     }; // HDF5IOHandlerImpl
 #else
     class HDF5IOHandlerImpl
@@ -0,0 +1,116 @@
+/* Copyright 2021 The openPMD Community
+ *
+ * This file is part of openPMD-api.
+ *
+ * openPMD-api is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openPMD-api is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with openPMD-api.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "openPMD/IO/IOTask.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+
+
+namespace openPMD
+{
+/** Accumulated cost of one kind of Operation in a backend.
+ */
+struct OperationStatistics
+{
+    //! number of tasks performed
+    uint64_t count = 0;
+    //! wall time spent in the backend, including time in I/O libraries
+    std::chrono::nanoseconds time{ 0 };
+    //! payload of dataset reads and writes in bytes, zero for other tasks
+    uint64_t bytes = 0;
+
+    OperationStatistics & operator+=( OperationStatistics const & other )
+    {
+        count += other.count;
+        time += other.time;
+        bytes += other.bytes;
+        return *this;
+    }
+};
+
+/** Per-Operation statistics of all tasks that a backend has performed.
+ *
+ * Collected by AbstractIOHandlerImpl::flush(), the cost is two clock reads
+ * per task.
+ */
+class IOStatistics
+{
+public:
+    static constexpr size_t numOperations =
+        static_cast< size_t >( Operation::PREFETCH_FILES ) + 1;
+
+    OperationStatistics const & operator[]( Operation op ) const
+    {
+        return m_operations[ static_cast< size_t >( op ) ];
+    }
+
+    void record( Operation op, std::chrono::nanoseconds time, uint64_t bytes )
+    {
+        auto & stats = m_operations[ static_cast< size_t >( op ) ];
+        ++stats.count;
+        stats.time += time;
+        stats.bytes += bytes;
+    }
+
+    /** Sum over all operations. */
+    OperationStatistics total() const
+    {
+        OperationStatistics res;
+        for( auto const & stats : m_operations )
+            res += stats;
+        return res;
+    }
+
+    /** Add to a backend-specific counter, e.g. of an optimization that
+     *  has taken effect.
+     */
+    void count( std::string const & counter, uint64_t n = 1 )
+    {
+        m_counters[ counter ] += n;
+    }
+
+    /** Value of a backend-specific counter, zero if never counted. */
+    uint64_t counter( std::string const & name ) const
+    {
+        auto it = m_counters.find( name );
+        return it == m_counters.end() ? 0 : it->second;
+    }
+
+    /** Render as a JSON object, keyed by operationToString().
+     *
+     * Operations that have not been performed are skipped.
+     * Backend-specific counters are listed under "counters".
+     *
+     * @param indent Indentation as in nlohmann::json::dump(), -1 for compact.
+     */
+    std::string toJSON( int indent = 2 ) const;
+
+private:
+    std::array< OperationStatistics, numOperations > m_operations{};
+    std::map< std::string, uint64_t > m_counters;
+}; // IOStatistics
+} // namespace openPMD
@@ -27,6 +27,7 @@
 #include "openPMD/Dataset.hpp"
 #include "openPMD/IterationEncoding.hpp"
 
+#include <cstddef>
 #include <memory>
 #include <map>
 #include <string>
@@ -72,11 +73,17 @@ OPENPMDAPI_EXPORT_ENUM_CLASS(Operation)
     WRITE_ATT,
     READ_ATT,
     LIST_ATTS,
+    READ_ATTS, //!< List and read all attributes of an object at once
 
     ADVANCE,
-    AVAILABLE_CHUNKS //!< Query chunks that can be loaded in a dataset
+    AVAILABLE_CHUNKS, //!< Query chunks that can be loaded in a dataset
+    PREFETCH_FILES //!< Announce files that will be opened for reading
 }; // Operation
 
+/** Return the name of an Operation, e.g. "WRITE_DATASET".
+ */
+std::string operationToString( Operation );
+
 struct OPENPMDAPI_EXPORT AbstractParameter
 {
     virtual ~AbstractParameter() = default;
@@ -176,6 +183,26 @@ struct OPENPMDAPI_EXPORT Parameter< Operation::DELETE_FILE > : public AbstractPa
     std::string name = "";
 };
 
+template<>
+struct OPENPMDAPI_EXPORT Parameter< Operation::PREFETCH_FILES > : public AbstractParameter
+{
+    Parameter() = default;
+    Parameter(Parameter const & p) :
+        AbstractParameter(), names(p.names), threads(p.threads) {}
+
+    std::unique_ptr< AbstractParameter >
+    clone() const override
+    {
+        return std::unique_ptr< AbstractParameter >(
+            new Parameter< Operation::PREFETCH_FILES >(*this));
+    }
+
+    //! files in the order in which they will be opened
+    std::vector< std::string > names;
+    //! upper bound for the number of threads loading files concurrently
+    unsigned threads = 1;
+};
+
 template<>
 struct OPENPMDAPI_EXPORT Parameter< Operation::CREATE_PATH > : public AbstractParameter
 {
@@ -269,8 +296,9 @@ struct OPENPMDAPI_EXPORT Parameter< Operation::CREATE_DATASET > : public Abstrac
     Parameter() = default;
     Parameter(Parameter const & p) : AbstractParameter(),
         name(p.name), extent(p.extent), dtype(p.dtype),
-        chunkSize(p.chunkSize), compression(p.compression),
-        transform(p.transform), options(p.options) {}
+        chunkSize(p.chunkSize), chunkSizeSpecified(p.chunkSizeSpecified),
+        compression(p.compression), transform(p.transform),
+        options(p.options) {}
 
     std::unique_ptr< AbstractParameter >
     clone() const override
@@ -283,6 +311,8 @@ struct OPENPMDAPI_EXPORT Parameter< Operation::CREATE_DATASET > : public Abstrac
     Extent extent = {};
     Datatype dtype = Datatype::UNDEFINED;
     Extent chunkSize = {};
+    //! chunkSize has been chosen by the user, see Dataset::setChunkSize()
+    bool chunkSizeSpecified = false;
     std::string compression = "";
     std::string transform = "";
     std::string options = "{}";
@@ -529,6 +559,32 @@ struct OPENPMDAPI_EXPORT Parameter< Operation::LIST_ATTS > : public AbstractPara
             = std::make_shared< std::vector< std::string > >();
 };
 
+template<>
+struct OPENPMDAPI_EXPORT Parameter< Operation::READ_ATTS > : public AbstractParameter
+{
+    Parameter() = default;
+    Parameter(Parameter const & p) : AbstractParameter(),
+        attributes(p.attributes), skipped(p.skipped) {}
+
+    std::unique_ptr< AbstractParameter >
+    clone() const override
+    {
+        return std::unique_ptr< AbstractParameter >(
+            new Parameter< Operation::READ_ATTS >(*this));
+    }
+
+    //! datatype and value as reported by READ_ATT
+    using Entry = std::pair< Datatype, Attribute::resource >;
+    using AttributeMap = std::map< std::string, Entry >;
+
+    //! output parameter: all attributes that could be read
+    std::shared_ptr< AttributeMap > attributes
+            = std::make_shared< AttributeMap >();
+    //! output parameter: attributes that could not be represented, with reason
+    std::shared_ptr< std::map< std::string, std::string > > skipped
+            = std::make_shared< std::map< std::string, std::string > >();
+};
+
 template<>
 struct OPENPMDAPI_EXPORT Parameter< Operation::ADVANCE > : public AbstractParameter
 {
@@ -579,6 +635,68 @@ struct OPENPMDAPI_EXPORT Parameter< Operation::AVAILABLE_CHUNKS >
     std::shared_ptr< ChunkTable > chunks = std::make_shared< ChunkTable >();
 };
 
+namespace internal
+{
+    /** Obtain memory for an IOTask parameter from a free list.
+     *
+     * IOTasks are created in large numbers and dropped in bulk once the
+     * task queue has been flushed, so their parameters are recycled through
+     * per-size free lists instead of going to the general-purpose allocator
+     * every time. Large requests are forwarded to ::operator new.
+     */
+    OPENPMDAPI_EXPORT void * allocateParameterMemory( std::size_t bytes );
+    OPENPMDAPI_EXPORT void
+    deallocateParameterMemory( void * ptr, std::size_t bytes ) noexcept;
+
+    /** Allocator for std::allocate_shared, placing the parameter and the
+     *  shared_ptr control block in one recycled block.
+     */
+    template< typename T >
+    struct ParameterAllocator
+    {
+        using value_type = T;
+
+        ParameterAllocator() = default;
+        template< typename U >
+        ParameterAllocator( ParameterAllocator< U > const & ) noexcept
+        { }
+
+        T * allocate( std::size_t n )
+        {
+            static_assert(
+                alignof( T ) <= alignof( std::max_align_t ),
+                "Over-aligned types cannot be pooled." );
+            return static_cast< T * >(
+                allocateParameterMemory( n * sizeof( T ) ) );
+        }
+
+        void deallocate( T * ptr, std::size_t n ) noexcept
+        {
+            deallocateParameterMemory( ptr, n * sizeof( T ) );
+        }
+
+        template< typename U >
+        bool operator==( ParameterAllocator< U > const & ) const noexcept
+        {
+            return true;
+        }
+
+        template< typename U >
+        bool operator!=( ParameterAllocator< U > const & ) const noexcept
+        {
+            return false;
+        }
+    };
+
+    template< Operation op >
+    std::shared_ptr< AbstractParameter >
+    makePooledParameter( Parameter< op > const & p )
+    {
+        return std::allocate_shared< Parameter< op > >(
+            ParameterAllocator< Parameter< op > >(), p );
+    }
+} // namespace internal
+
 /** @brief Self-contained description of a single IO operation.
  *
  * Contained are
@@ -601,7 +719,7 @@ public:
            Parameter< op > const & p)
             : writable{w},
               operation{op},
-              parameter{p.clone()}
+              parameter{internal::makePooledParameter(p)}
     { }
 
     template< Operation op >
@@ -609,7 +727,7 @@ public:
            Parameter< op > const & p)
             : writable{getWritable(a)},
               operation{op},
-              parameter{p.clone()}
+              parameter{internal::makePooledParameter(p)}
     { }
 
     explicit IOTask(IOTask const & other) :
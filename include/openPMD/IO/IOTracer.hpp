@@ -0,0 +1,121 @@
+/* Copyright 2021 The openPMD Community
+ *
+ * This file is part of openPMD-api.
+ *
+ * openPMD-api is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openPMD-api is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with openPMD-api.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+
+namespace openPMD
+{
+class IOTask;
+
+/** Records a timeline of IO activity in the Chrome trace event format.
+ *
+ * Every IOTask performed by a backend becomes a span carrying its
+ * Operation, the path of its Writable and, for datasets, datatype and
+ * extent. Frontend calls such as Series::flush() add enclosing spans.
+ * The trace is written to a JSON file upon destruction, which can be
+ * loaded into chrome://tracing or https://ui.perfetto.dev.
+ * Timestamps are taken from the system clock, so that traces of several
+ * MPI ranks (which use the rank as process id) can be aligned.
+ */
+class IOTracer
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @param file Path of the trace file to write upon destruction.
+     * @param rank MPI rank, used as process id in the trace.
+     */
+    IOTracer( std::string file, int rank = 0 );
+    ~IOTracer();
+
+    IOTracer( IOTracer const & ) = delete;
+    IOTracer & operator=( IOTracer const & ) = delete;
+
+    /** Record a span for a task performed in a backend. */
+    void recordTask(
+        IOTask const &, Clock::time_point begin, Clock::time_point end );
+
+    /** Record a span for a frontend call. */
+    void recordSpan(
+        std::string name,
+        std::string category,
+        Clock::time_point begin,
+        Clock::time_point end );
+
+    /** Write the trace collected so far to the trace file. */
+    void write() const;
+
+    /** RAII span that is recorded upon destruction, no-op without tracer.
+     */
+    class Scope
+    {
+    public:
+        Scope(
+            std::shared_ptr< IOTracer > tracer,
+            char const * name,
+            char const * category = "frontend" );
+        ~Scope();
+
+        Scope( Scope const & ) = delete;
+        Scope & operator=( Scope const & ) = delete;
+
+    private:
+        std::shared_ptr< IOTracer > m_tracer;
+        char const * m_name;
+        char const * m_category;
+        Clock::time_point m_begin;
+    };
+
+private:
+    struct Event
+    {
+        std::string name;
+        std::string category;
+        double begin; //!< microseconds since the epoch of the system clock
+        double duration; //!< microseconds
+        unsigned thread;
+        std::vector< std::pair< std::string, std::string > > args;
+    };
+
+    void record( Event );
+    double microseconds( Clock::time_point ) const;
+    unsigned threadIndex();
+
+    std::string m_file;
+    int m_rank;
+    //! system clock time at steady clock time point zero, in microseconds
+    double m_epochOffset;
+
+    mutable std::mutex m_mutex;
+    std::vector< Event > m_events;
+    std::map< std::thread::id, unsigned > m_threads;
+}; // IOTracer
+} // namespace openPMD
@@ -34,13 +34,19 @@ namespace openPMD
     public:
         JSONIOHandler(
             std::string path,
-            Access at
+            Access at,
+            nlohmann::json config = nlohmann::json::object(),
+            std::string encoding = "json"
         );
 
         ~JSONIOHandler( ) override;
 
         std::string backendName() const override { return "JSON"; }
 
+        bool supportsBackgroundFlush() const override { return true; }
+
+        bool supportsPrefetch() const override { return true; }
+
         std::future< void > flush( ) override;
 
     private:
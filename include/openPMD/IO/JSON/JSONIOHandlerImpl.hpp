@@ -31,7 +31,9 @@
 #include <nlohmann/json.hpp>
 
 #include <complex>
+#include <cstddef>
 #include <fstream>
+#include <list>
 #include <memory>
 #include <tuple>
 #include <unordered_map>
@@ -166,7 +168,16 @@ namespace openPMD
         using json = nlohmann::json;
 
     public:
-        explicit JSONIOHandlerImpl( AbstractIOHandler * );
+        /**
+         * @param encoding On-disk encoding of the JSON tree, also the file
+         *        extension: "json" for text, or one of the binary encodings
+         *        "cbor", "msgpack", "ubjson" and "bson". May be overridden
+         *        by json.encoding in the config.
+         */
+        explicit JSONIOHandlerImpl(
+            AbstractIOHandler *,
+            nlohmann::json config = nlohmann::json::object(),
+            std::string encoding = "json" );
 
         ~JSONIOHandlerImpl( ) override;
 
@@ -221,6 +232,11 @@ namespace openPMD
             Parameter< Operation::DELETE_FILE > const &
         ) override;
 
+        void prefetchFiles(
+            Writable *,
+            Parameter< Operation::PREFETCH_FILES > const &
+        ) override;
+
         void deletePath(
             Writable *,
             Parameter< Operation::DELETE_PATH > const &
@@ -256,6 +272,11 @@ namespace openPMD
             Parameter< Operation::READ_ATT > &
         ) override;
 
+        void readAttributes(
+            Writable *,
+            Parameter< Operation::READ_ATTS > &
+        ) override;
+
         void listPaths(
             Writable *,
             Parameter< Operation::LIST_PATHS > &
@@ -278,6 +299,59 @@ namespace openPMD
 
         using FILEHANDLE = std::fstream;
 
+        enum class FileEncoding
+        {
+            Text,
+            CBOR,
+            MessagePack,
+            UBJSON,
+            BSON
+        };
+
+        FileEncoding m_encoding = FileEncoding::Text;
+
+        // file extension including the dot, e.g. ".json"
+        std::string m_suffix = ".json";
+
+        // indent text output instead of writing it without whitespace
+        // configured by json.format, "compact" or "pretty"
+        bool m_pretty = false;
+
+        /*
+         * Nested: a dataset's "data" is a nested array, one level per
+         *         dimension.
+         * Flat:   "data" is a one-dimensional array in row-major order,
+         *         the dataset carries its "extent" explicitly.
+         * Base64: "data" is a base64 string of the raw little-endian
+         *         row-major buffer, the dataset carries its "extent".
+         * Reading detects the layout of each dataset (by the "extent" key
+         * and the type of "data"), this only selects the layout of newly
+         * created datasets.
+         */
+        enum class DatasetLayout
+        {
+            Nested,
+            Flat,
+            Base64
+        };
+
+        DatasetLayout m_datasetLayout = DatasetLayout::Nested;
+
+        /*
+         * In read-only mode, text files are parsed without the contents of
+         * their datasets: "data" is left as an empty array and only the
+         * position of the array within the file is recorded. The actual
+         * data is parsed upon first reading the dataset.
+         * Configured by json.defer_dataset_parsing.
+         */
+        bool m_deferDatasets = true;
+
+        // parse files from a read-only memory mapping instead of reading
+        // them through iostreams, falling back to the latter if mapping
+        // fails
+        // configured by json.mmap
+        bool m_mmap = true;
+
         // map each Writable to its associated file
         // contains only the filename, without the OS path
         std::unordered_map<
@@ -285,17 +359,53 @@ namespace openPMD
             File
         > m_files;
 
-        std::unordered_map<
-            File,
-            std::shared_ptr< nlohmann::json >> m_jsonVals;
+        struct CachedFile
+        {
+            std::shared_ptr< nlohmann::json > contents;
+            // size of the file on disk, as an estimate of its memory usage
+            size_t bytes = 0;
+            // position within m_lru
+            std::list< File >::iterator lruPosition;
+        };
+
+        // parsed contents of the files, kept resident across flushes
+        std::unordered_map< File, CachedFile > m_jsonVals;
+
+        // files in m_jsonVals, the least recently used one at the back
+        std::list< File > m_lru;
+
+        // sum of CachedFile::bytes over m_jsonVals
+        size_t m_cachedBytes = 0;
+
+        // once m_cachedBytes exceeds this, least recently used files are
+        // written (if dirty) and dropped from m_jsonVals
+        // configured by json.cache_size, 0 keeps only the file in use
+        size_t m_cacheSize = 256 * 1024 * 1024;
 
         // files that have logically, but not physically been written to
         std::unordered_set< File > m_dirty;
 
+        // number of threads serializing the modified files upon flush()
+        // configured by json.flush_threads, 0 uses one thread per core
+        unsigned m_flushThreads = 1;
+
+        // reads and parses files announced by prefetchFiles() on worker
+        // threads, consumed by obtainJsonContents()
+        class Prefetcher;
+        std::unique_ptr< Prefetcher > m_prefetcher;
+
 
         // HELPER FUNCTIONS
 
 
+        // serialize the given file contents to disk, return the bytes
+        // written
+        // does not modify the handler's state, so independent files may be
+        // written concurrently
+        size_t writeJsonFile(
+            File const &,
+            nlohmann::json & );
+
         // will use the IOHandler to retrieve the correct directory
         // shared pointer to circumvent the fact that c++ pre 17 does
         // not enforce (only allow) copy elision in return statements
@@ -309,6 +419,44 @@ namespace openPMD
 
         std::string fullPath( std::string const & );
 
+        static FileEncoding encodingFromString( std::string const & );
+
+        static DatasetLayout datasetLayoutFromString( std::string const & );
+
+        // true for "pretty", false for "compact"
+        static bool formatFromString( std::string const & );
+
+        // (de)serialize a JSON tree in the given encoding
+        // deferDatasets: skip the payload of datasets, see m_deferDatasets,
+        // only applicable to FileEncoding::Text
+        static void parseJson(
+            std::istream &,
+            nlohmann::json &,
+            FileEncoding,
+            bool deferDatasets = false );
+
+        static void parseJson(
+            char const * begin,
+            char const * end,
+            nlohmann::json &,
+            FileEncoding,
+            bool deferDatasets = false );
+
+        // parse the file at the given path from a memory mapping
+        // returns false without parsing if the file cannot be mapped
+        static bool parseMappedFile(
+            std::string const & path,
+            nlohmann::json &,
+            FileEncoding,
+            bool deferDatasets );
+
+        // pretty: indent the output, only applicable to FileEncoding::Text
+        static void dumpJson(
+            std::ostream &,
+            nlohmann::json const &,
+            FileEncoding,
+            bool pretty = false );
+
         // from a path specification /a/b/c, remove the last
         // "folder" (i.e. modify the string to equal /a/b)
         static void parentDir( std::string & );
@@ -335,6 +483,22 @@ namespace openPMD
             size_t currentdim = 0
         );
 
+        // Same as syncMultidimensionalJson, but for a dataset in flat layout
+        // with the given extent, j being its one-dimensional data array.
+        // Copies contiguous rows of the last dimension.
+        template<
+            typename T,
+            typename Visitor
+        >
+        static void syncFlatJson(
+            nlohmann::json & j,
+            Extent const & datasetExtent,
+            Offset const & offset,
+            Extent const & extent,
+            Visitor visitor,
+            T * data
+        );
+
         // multiplicators: an array [m_0,...,m_n] s.t.
         // data[i_0]...[i_n] = data[m_0*i_0+...+m_n*i_n]
         // (m_n = 1)
@@ -345,6 +509,14 @@ namespace openPMD
 
         static Extent getExtent( nlohmann::json & j );
 
+        // whether a dataset is stored in DatasetLayout::Base64
+        static bool isBase64Dataset( nlohmann::json const & j );
+
+        // parse the data of a dataset whose parsing has been deferred
+        void loadDeferredData(
+            Writable *,
+            nlohmann::json & dataset );
+
 
         // remove single '/' in the beginning and end of a string
         static std::string removeSlashes( std::string );
@@ -357,7 +529,8 @@ namespace openPMD
 
         // make sure that the given path exists in proper form in
         // the passed json value
-        static void ensurePath(
+        // returns whether any part of the path had to be created
+        static bool ensurePath(
             nlohmann::json * json,
             std::string path
         );
@@ -366,7 +539,8 @@ namespace openPMD
         // with a new pointer (e.g. when reopening), search for a possibly
         // existing old pointer. Construct a new pointer only upon failure.
         // The bool is true iff the pointer has been newly-created.
-        // The iterator is an iterator for m_files
+        // Files that are no longer open, but still cached, are found too.
+        // The iterator is an iterator for m_files (end() for such files)
         std::tuple<
             File,
             std::unordered_map<
@@ -382,10 +556,25 @@ namespace openPMD
         // from disk
         std::shared_ptr< nlohmann::json > obtainJsonContents( File );
 
+        // add the contents of a file to m_jsonVals as most recently used,
+        // evicting other files if the cache size is exceeded
+        void cacheFile(
+            File const &,
+            std::shared_ptr< nlohmann::json >,
+            size_t bytes );
+
+        // drop the contents of a file from m_jsonVals without writing them
+        void uncacheFile( File const & );
+
+        // drop least recently used files other than keep from m_jsonVals
+        // until the cache size is respected, writing dirty ones first
+        void evictFiles( File const & keep );
+
         // get the json value at the writable's fileposition
         nlohmann::json & obtainJsonContents( Writable * writable );
 
-        // write to disk the json contents associated with the file
+        // write to disk the json contents associated with the file,
+        // keeping them cached
         // remove from m_dirty if unsetDirty == true
         void putJsonContents(
             File,
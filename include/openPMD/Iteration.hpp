@@ -47,6 +47,7 @@ class Iteration : public LegacyAttributable
     friend class SeriesImpl;
     friend class WriteIterations;
     friend class SeriesIterator;
+    friend struct traits::AccessPolicy< Iteration >;
 
 public:
     Iteration( Iteration const & ) = default;
@@ -301,11 +302,9 @@ private:
     dirtyRecursive() const;
 
     /**
-     * @brief Link with parent.
-     * 
-     * @param w The Writable representing the parent.
+     * @brief Link meshes and particles with this Iteration.
      */
-    virtual void linkHierarchy(Writable& w);
+    void relinkChildren() override;
 
     /**
      * @brief Access an iteration in read mode that has potentially not been
@@ -315,6 +314,18 @@ private:
     void runDeferredParseAccess();
 };  // Iteration
 
+namespace traits
+{
+    /** Parse an iteration whose parsing has been deferred upon accessing it
+     *  via Series::iterations, so users need not Iteration::open() it.
+     */
+    template<>
+    struct AccessPolicy< Iteration >
+    {
+        void operator()( Iteration & );
+    };
+} // traits
+
 extern template
 float
 Iteration::time< float >() const;
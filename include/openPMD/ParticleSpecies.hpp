@@ -45,6 +45,7 @@ private:
 
     void read();
     void flush(std::string const &) override;
+    void relinkChildren() override;
 
     /**
      * @brief Check recursively whether this ParticleSpecies is dirty.
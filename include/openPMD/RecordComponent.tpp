@@ -151,6 +151,7 @@ inline void RecordComponent::loadChunk(
         dRead.dtype = getDatatype();
         dRead.data = std::static_pointer_cast< void >(data);
         m_chunks->push(IOTask(this, dRead));
+        markIterationDirty();
     }
 }
 
@@ -202,6 +203,7 @@ RecordComponent::storeChunk(std::shared_ptr<T> data, Offset o, Extent e)
     /* std::static_pointer_cast correctly reference-counts the pointer */
     dWrite.data = std::static_pointer_cast< void const >(data);
     m_chunks->push(IOTask(this, dWrite));
+    markIterationDirty();
 }
 
 template< typename T_ContiguousContainer >
@@ -294,6 +296,7 @@ RecordComponent::storeChunk( Offset o, Extent e, F && createBuffer )
         dCreate.extent = getExtent();
         dCreate.dtype = getDatatype();
         dCreate.chunkSize = m_dataset->chunkSize;
+        dCreate.chunkSizeSpecified = m_dataset->chunkSizeSpecified;
         dCreate.compression = m_dataset->compression;
         dCreate.transform = m_dataset->transform;
         dCreate.options = m_dataset->options;
@@ -26,6 +26,7 @@
 #include "openPMD/IO/AbstractIOHandler.hpp"
 #include "openPMD/IO/Access.hpp"
 #include "openPMD/IO/Format.hpp"
+#include "openPMD/IO/IOStatistics.hpp"
 #include "openPMD/Iteration.hpp"
 #include "openPMD/IterationEncoding.hpp"
 #include "openPMD/Streaming.hpp"
@@ -41,8 +42,11 @@
 #   include <mpi.h>
 #endif
 
+#include <future>
 #include <map>
+#include <set>
 #include <string>
+#include <vector>
 
 // expose private and protected members for invasive testing
 #ifndef OPENPMD_private
@@ -96,6 +100,38 @@ public:
      */
     StepStatus m_stepStatus = StepStatus::NoStep;
     bool m_parseLazily = false;
+    /**
+     * Number of threads that the backend may use to load the files of a
+     * file-based Series ahead of parsing them eagerly, 0 for one per core.
+     * Only the JSON backend implements this (PREFETCH_FILES).
+     */
+    unsigned m_parsingThreads = 1;
+    /**
+     * Run the data-carrying part of user-triggered flushes on a worker
+     * thread, see AsyncIOHandler.
+     */
+    bool m_asynchronousFlush = false;
+    /**
+     * Write IOStatistics as JSON to this file upon destruction.
+     */
+    auxiliary::Option< std::string > m_statisticsFile;
+    /**
+     * Record a timeline of all IO tasks, written to this file, see IOTracer.
+     */
+    auxiliary::Option< std::string > m_traceFile;
+    /**
+     * Indices of the iterations that a flush of the whole Series needs to
+     * visit: those that are neither closed in the backend nor waiting for
+     * deferred parsing, and those modified since the last flush, see
+     * AttributableImpl::markIterationDirty().
+     * Keeps the cost of SeriesImpl::flush() independent of the number of
+     * iterations that have been finished before.
+     * May temporarily contain stale entries, which the next flush removes.
+     * Shared so that objects can refer to it weakly, they may outlive the
+     * Series.
+     */
+    std::shared_ptr< std::set< uint64_t > > m_activeIterations =
+        std::make_shared< std::set< uint64_t > >();
     bool m_lastFlushSuccessful = true;
 }; // SeriesData
 
@@ -307,10 +343,29 @@ public:
      */
     std::string backend() const;
 
+    /** Per-Operation count, wall time and bytes of all IO tasks that the
+     *  backend has performed so far.
+     *
+     * @see IOStatistics
+     */
+    IOStatistics ioStatistics() const;
+
     /** Execute all required remaining IO operations to write or read data.
      */
     void flush();
 
+    /** Like flush(), but return a future that becomes ready once the data
+     *  has been written.
+     *
+     * With asynchronous flushing (see the JSON option
+     * asynchronous_flush), the writing of datasets continues in the
+     * background after returning, otherwise the future is ready already.
+     * Errors in the background are reported through the future only, not
+     * again by the next flush.
+     * Buffers passed to storeChunk() must not be modified until then.
+     */
+    std::future< void > flushAsync();
+
 OPENPMD_private:
     static constexpr char const * const BASEPATH = "/data/%T/";
 
@@ -373,6 +428,19 @@ OPENPMD_private:
      * .*GorVBased, short for .*GroupOrVariableBased
      */
     void flushGorVBased( iterations_iterator begin, iterations_iterator end );
+    /**
+     * The iterations within [begin, end) that need to be visited by a flush.
+     * For the whole range, these are taken from
+     * SeriesData::m_activeIterations instead of walking all iterations.
+     */
+    std::vector< iterations_iterator > iterationsToFlush(
+        iterations_iterator begin, iterations_iterator end );
+    /**
+     * Update SeriesData::m_activeIterations after flushing the given
+     * iterations.
+     */
+    void trackActiveIterations(
+        std::vector< iterations_iterator > const & flushed );
     void flushMeshesPath();
     void flushParticlesPath();
     void readFileBased( );
@@ -73,6 +73,10 @@ namespace auxiliary
          * @brief Get the "shadow", i.e. a copy of the original JSON value
          * containing all accessed object keys.
          *
+         * Arrays that are read as a whole count as fully read. Within
+         * arrays that are indexed by operator[](), the unaccessed keys of
+         * objects are tracked like above.
+         *
          * @return nlohmann::json const&
          */
         nlohmann::json const &
@@ -142,15 +146,18 @@ namespace auxiliary
     {
         nlohmann::json * newPositionInOriginal =
             &m_positionInOriginal->operator[]( key );
-        // If accessing a leaf in the JSON tree from an object (not an array!)
-        // erase the corresponding key
+        // If accessing a leaf in the JSON tree from an object or from an
+        // array that has been indexed, erase the corresponding key
         static nlohmann::json nullvalue;
         nlohmann::json * newPositionInShadow = &nullvalue;
-        if( m_trace && m_positionInOriginal->is_object() )
+        if( m_trace &&
+            ( m_positionInOriginal->is_object() ||
+              m_positionInOriginal->is_array() ) )
         {
             newPositionInShadow = &m_positionInShadow->operator[]( key );
         }
-        bool traceFurther = newPositionInOriginal->is_object();
+        bool traceFurther = newPositionInOriginal->is_object() ||
+            newPositionInOriginal->is_array();
         return TracingJSON(
             m_originalJSON,
             m_shadow,
@@ -0,0 +1,89 @@
+/* Copyright 2021 The openPMD Community
+ *
+ * This file is part of openPMD-api.
+ *
+ * openPMD-api is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openPMD-api is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with openPMD-api.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace openPMD
+{
+namespace auxiliary
+{
+/** Call f( i ) for i in [0, n) on up to the given number of threads.
+ *
+ * The calling thread is one of them.
+ *
+ * @param n Number of iterations.
+ * @param threads Maximum number of threads, 0 uses one thread per core.
+ * @param f Callable taking the iteration index.
+ * @throws The first exception thrown by f, after all threads have finished.
+ */
+template< typename F >
+void parallelFor( std::size_t n, unsigned threads, F && f )
+{
+    if( threads == 0 )
+    {
+        threads = std::max( 1u, std::thread::hardware_concurrency( ) );
+    }
+    std::atomic< std::size_t > next{ 0 };
+    std::mutex errorMutex;
+    std::exception_ptr error;
+    auto work = [ & ]( )
+    {
+        for( std::size_t i; ( i = next++ ) < n; )
+        {
+            try
+            {
+                f( i );
+            }
+            catch( ... )
+            {
+                std::lock_guard< std::mutex > lock( errorMutex );
+                if( !error )
+                {
+                    error = std::current_exception( );
+                }
+            }
+        }
+    };
+    std::vector< std::thread > pool;
+    for( std::size_t t = 1; t < std::min< std::size_t >( threads, n ); ++t )
+    {
+        pool.emplace_back( work );
+    }
+    work( );
+    for( auto & thread : pool )
+    {
+        thread.join( );
+    }
+    if( error )
+    {
+        std::rethrow_exception( error );
+    }
+}
+} // namespace auxiliary
+} // namespace openPMD
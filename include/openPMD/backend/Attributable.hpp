@@ -28,6 +28,7 @@
 #include <exception>
 #include <map>
 #include <memory>
+#include <set>
 #include <vector>
 #include <string>
 #include <cstddef>
@@ -81,6 +82,17 @@ public:
 
 private:
     A_MAP m_attributes;
+    /**
+     * Keys of the attributes that have been set since the last call to
+     * AttributableImpl::flushAttributes().
+     */
+    std::set< std::string > m_dirtyAttributes;
+    /**
+     * Attributes read from the backend by a single READ_ATTS task while
+     * parsing this object, consumed by AttributableImpl::readAttributes().
+     * Dropped when attributes are written or deleted.
+     */
+    std::unique_ptr< Parameter< Operation::READ_ATTS > > m_prefetchedAttributes;
 };
 }
 
@@ -105,10 +117,12 @@ class AttributableImpl
     template< typename T >
     friend struct traits::GenerationPolicy;
     friend class Iteration;
+    friend class ParticleSpecies;
     friend class Series;
     friend class SeriesImpl;
     friend class Writable;
     friend class WriteIterations;
+    friend struct test::TestHelper;
 
 protected:
     internal::AttributableData * m_attri = nullptr;
@@ -236,6 +250,15 @@ OPENPMD_protected:
     internal::SeriesInternal & retrieveSeries();
 
     void seriesFlush( FlushLevel );
+    /**
+     * Remember the Iteration that contains this object as modified, so the
+     * next flush of the whole Series visits it.
+     * The enclosing Iteration is resolved once and then cached in the
+     * Writable, see Writable::iterationIndex.
+     * No-op for objects that are not (yet) linked into an Iteration or
+     * whose Series has been destroyed.
+     */
+    void markIterationDirty();
 
     void flushAttributes();
     enum ReadMode {
@@ -257,6 +280,28 @@ OPENPMD_protected:
     };
     void readAttributes( ReadMode );
 
+    /** Read a single attribute from the backend.
+     *
+     * Upon first use while parsing an object, all of its attributes are
+     * read in a single READ_ATTS task and kept until the final call to
+     * readAttributes(), so parsing an object costs one backend round trip
+     * rather than one per attribute.
+     * Attributes not found that way are read from the backend directly,
+     * i.e. errors are reported as for a READ_ATT task.
+     */
+    void readAttribute( Parameter< Operation::READ_ATT > & );
+    /** Whether the backend holds an attribute of that name for this object.
+     *
+     * Uses (and prefetches, if necessary) the attributes read for
+     * readAttribute().
+     */
+    bool containsAttributeInBackend( std::string const & key );
+
+private:
+    Parameter< Operation::READ_ATTS > & prefetchAttributes();
+
+OPENPMD_protected:
+
     /** Retrieve the value of a floating point Attribute of user-defined precision with ensured type-safety.
      *
      * @note    Since the precision of certain Attributes is intentionally left
@@ -358,6 +403,20 @@ private:
      * @param w The Writable representing the parent.
      */
     virtual void linkHierarchy(Writable& w);
+    /**
+     * @brief Take over IOHandler and Series from a (new) parent and
+     *        forget the Iteration that markIterationDirty() has resolved,
+     *        for this object and all objects below it.
+     *
+     * @param w The Writable representing the parent.
+     */
+    void adoptLink(Writable const& w);
+    /**
+     * @brief Call adoptLink() on all children of this object.
+     *
+     * Overridden by classes that contain further objects.
+     */
+    virtual void relinkChildren();
 }; // AttributableImpl
 
 // Alias this as Attributable since this is a public abstract parent class
@@ -393,6 +452,8 @@ AttributableImpl::setAttribute( std::string const & key, T value )
     }
 
     dirty() = true;
+    attri.m_dirtyAttributes.insert(key);
+    markIterationDirty();
     auto it = attri.m_attributes.lower_bound(key);
     if( it != attri.m_attributes.end()
         && !attri.m_attributes.key_comp()(key, it->first) )
@@ -264,8 +264,7 @@ BaseRecord< T_elem >::readBase()
     Parameter< Operation::READ_ATT > aRead;
 
     aRead.name = "unitDimension";
-    this->IOHandler()->enqueue(IOTask(this, aRead));
-    this->IOHandler()->flush();
+    this->readAttribute( aRead );
     if( *aRead.dtype == DT::ARR_DBL_7 )
         this->setAttribute("unitDimension", Attribute(*aRead.resource).template get< std::array< double, 7 > >());
     else if( *aRead.dtype == DT::VEC_DOUBLE )
@@ -285,8 +284,7 @@ BaseRecord< T_elem >::readBase()
         throw std::runtime_error("Unexpected Attribute datatype for 'unitDimension'");
 
     aRead.name = "timeOffset";
-    this->IOHandler()->enqueue(IOTask(this, aRead));
-    this->IOHandler()->flush();
+    this->readAttribute( aRead );
     if( *aRead.dtype == DT::FLOAT )
         this->setAttribute("timeOffset", Attribute(*aRead.resource).template get< float >());
     else if( *aRead.dtype == DT::DOUBLE )
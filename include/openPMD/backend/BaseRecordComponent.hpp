@@ -65,10 +65,15 @@ public:
      * information may hence differ between different backends:
      * * The ADIOS backends (versions 1 and 2) will return those chunks that
      *   the writer has originally written.
-     * * The JSON backend will reconstruct the chunks by iterating the dataset.
-     * * The HDF5 backend will return the whole dataset as one large chunk.
-     *   HDF5's notion of chunking is currently ignored.
+     * * The JSON backend will return the chunks recorded in the dataset's
+     *   chunk table upon writing. For datasets without a chunk table, as
+     *   written by older versions, it reconstructs them by iterating the
+     *   dataset, or returns the whole dataset if it is base64-encoded.
+     * * The HDF5 backend will return the HDF5 chunks allocated in the file,
+     *   i.e. those that have been written to, clipped to the dataset's extent.
      *   (https://support.hdfgroup.org/HDF5/doc/Advanced/Chunking/)
+     *   Unchunked datasets (and chunked ones with HDF5 versions older than
+     *   1.10.5) are returned as one large chunk.
      *
      * The results depend solely on the backend and are independent of any
      * openPMD-related information. Note that this call currently does not take
@@ -54,6 +54,21 @@ namespace traits
         {
         }
     };
+
+    /** Container Element Access Policy
+     *
+     * The operator() of this policy is called when an already existing
+     * element is accessed via operator[]() or the non-const at(), before
+     * returning it. The passed parameter is the accessed element.
+     */
+    template< typename U >
+    struct AccessPolicy
+    {
+        template< typename T >
+        void operator()(T &)
+        {
+        }
+    };
 } // traits
 
 namespace internal
@@ -172,7 +187,13 @@ public:
 
     void swap(Container & other) { m_container->swap(other.m_container); }
 
-    mapped_type& at(key_type const& key) { return m_container->at(key); }
+    mapped_type& at(key_type const& key)
+    {
+        auto& ret = m_container->at(key);
+        traits::AccessPolicy< T > access;
+        access(ret);
+        return ret;
+    }
     mapped_type const& at(key_type const& key) const { return m_container->at(key); }
 
     /** Access the value that is mapped to a key equivalent to key, creating it if such key does not exist already.
@@ -185,7 +206,11 @@ public:
     {
         auto it = m_container->find(key);
         if( it != m_container->end() )
+        {
+            traits::AccessPolicy< T > access;
+            access(it->second);
             return it->second;
+        }
         else
         {
             if(Access::READ_ONLY == IOHandler()->m_frontendAccess )
@@ -201,6 +226,7 @@ public:
                 detail::keyAsString( key, writable().ownKeyWithinParent );
             traits::GenerationPolicy< T > gen;
             gen(ret);
+            ret.markIterationDirty();
             return ret;
         }
     }
@@ -214,7 +240,11 @@ public:
     {
         auto it = m_container->find(key);
         if( it != m_container->end() )
+        {
+            traits::AccessPolicy< T > access;
+            access(it->second);
             return it->second;
+        }
         else
         {
             if(Access::READ_ONLY == IOHandler()->m_frontendAccess )
@@ -230,6 +260,7 @@ public:
                 std::move( key ), writable().ownKeyWithinParent );
             traits::GenerationPolicy< T > gen;
             gen( ret );
+            ret.markIterationDirty();
             return ret;
         }
     }
@@ -326,6 +357,12 @@ OPENPMD_protected:
 
     std::shared_ptr< InternalContainer > m_container;
 
+    void relinkChildren() override
+    {
+        for( auto & entry : *m_container )
+            entry.second.adoptLink( writable() );
+    }
+
     /**
      * This class wraps a Container and forwards operator[]() and at() to it.
      * It remembers the keys used for accessing. Upon going out of scope, all
@@ -119,6 +119,7 @@ PatchRecordComponent::load(std::shared_ptr< T > data)
     dRead.dtype = getDatatype();
     dRead.data = std::static_pointer_cast< void >(data);
     m_chunks->push(IOTask(this, dRead));
+    markIterationDirty();
 }
 
 template< typename T >
@@ -148,5 +149,6 @@ PatchRecordComponent::store(uint64_t idx, T data)
     dWrite.dtype = dtype;
     dWrite.data = std::make_shared< T >(data);
     m_chunks->push(IOTask(this, dWrite));
+    markIterationDirty();
 }
 } // namespace openPMD
@@ -22,6 +22,8 @@
 
 #include "openPMD/IO/AbstractIOHandler.hpp"
 
+#include <cstdint>
+#include <set>
 #include <string>
 #include <memory>
 #include <vector>
@@ -85,8 +87,9 @@ class Writable final
     friend class ParallelHDF5IOHandlerImpl;
     friend class AbstractIOHandlerImplCommon<ADIOS2FilePosition>;
     friend class JSONIOHandlerImpl;
+    friend class IOTracer;
     friend struct test::TestHelper;
-    friend std::string concrete_h5_file_position(Writable*);
+    friend std::string const & concrete_h5_file_position(Writable*);
     friend std::string concrete_bp1_file_position(Writable*);
     template<typename>
     friend class Span;
@@ -129,6 +132,21 @@ OPENPMD_private:
      * but instead their parent's parent, hence a vector of keys)
      */
     std::vector< std::string > ownKeyWithinParent;
+    /**
+     * The active iterations of the Series containing this object, handed
+     * down from the parent by AttributableImpl::linkHierarchy().
+     * Held weakly since this object may outlive its Series, expired or empty
+     * for objects outside of a Series.
+     */
+    std::weak_ptr< std::set< uint64_t > > activeIterations;
+    /**
+     * Cache for AttributableImpl::markIterationDirty(): the index of the
+     * enclosing Iteration, valid if iterationResolved.
+     * Resolved by walking up the parents on first use, reset upon relinking
+     * this object or one of its ancestors.
+     */
+    uint64_t iterationIndex;
+    bool iterationResolved;
     /**
      * @brief Whether a Writable has been written to the backend.
      *
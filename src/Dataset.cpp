@@ -61,6 +61,7 @@ Dataset::setChunkSize(Extent const& cs)
             throw std::runtime_error("Dataset chunk size must be equal or smaller than Extent");
 
     chunkSize = cs;
+    chunkSizeSpecified = true;
     return *this;
 }
 
@@ -59,6 +59,14 @@ namespace openPMD {
             return Format::ADIOS2_SSC;
         if (auxiliary::ends_with(filename, ".json"))
             return Format::JSON;
+        if (auxiliary::ends_with(filename, ".cbor"))
+            return Format::JSON_CBOR;
+        if (auxiliary::ends_with(filename, ".msgpack"))
+            return Format::JSON_MSGPACK;
+        if (auxiliary::ends_with(filename, ".ubjson"))
+            return Format::JSON_UBJSON;
+        if (auxiliary::ends_with(filename, ".bson"))
+            return Format::JSON_BSON;
         if (std::string::npos != filename.find('.') /* extension is provided */ )
             throw std::runtime_error("Unknown file format. Did you append a valid filename extension?");
 
@@ -79,6 +87,14 @@ namespace openPMD {
                 return ".ssc";
             case Format::JSON:
                 return ".json";
+            case Format::JSON_CBOR:
+                return ".cbor";
+            case Format::JSON_MSGPACK:
+                return ".msgpack";
+            case Format::JSON_UBJSON:
+                return ".ubjson";
+            case Format::JSON_BSON:
+                return ".bson";
             default:
                 return "";
         }
@@ -122,6 +122,8 @@ ADIOS2IOHandlerImpl::~ADIOS2IOHandlerImpl()
 void
 ADIOS2IOHandlerImpl::init( nlohmann::json cfg )
 {
+    // reads are only performed after all tasks of a flush
+    m_coalesceReads = false;
     if( cfg.contains( "adios2" ) )
     {
         m_config = std::move( cfg[ "adios2" ] );
@@ -166,6 +166,9 @@ ParallelADIOS1IOHandlerImpl::flush()
                 case O::DELETE_FILE:
                     deleteFile(i.writable, deref_dynamic_cast< Parameter< O::DELETE_FILE > >(i.parameter.get()));
                     break;
+                case O::PREFETCH_FILES:
+                    prefetchFiles(i.writable, deref_dynamic_cast< Parameter< O::PREFETCH_FILES > >(i.parameter.get()));
+                    break;
                 case O::DELETE_PATH:
                     deletePath(i.writable, deref_dynamic_cast< Parameter< O::DELETE_PATH > >(i.parameter.get()));
                     break;
@@ -196,6 +199,9 @@ ParallelADIOS1IOHandlerImpl::flush()
                 case O::LIST_ATTS:
                     listAttributes(i.writable, deref_dynamic_cast< Parameter< O::LIST_ATTS > >(i.parameter.get()));
                     break;
+                case O::READ_ATTS:
+                    readAttributes(i.writable, deref_dynamic_cast< Parameter< O::READ_ATTS > >(i.parameter.get()));
+                    break;
                 case O::ADVANCE:
                     advance(i.writable, deref_dynamic_cast< Parameter< O::ADVANCE > >(i.parameter.get()));
                     break;
@@ -101,7 +101,20 @@ namespace openPMD
                     path, access, std::move( options ), "ssc" );
 #endif // openPMD_HAVE_ADIOS2
             case Format::JSON:
-                return std::make_shared< JSONIOHandler >( path, access );
+                return std::make_shared< JSONIOHandler >(
+                    path, access, std::move( options ), "json" );
+            case Format::JSON_CBOR:
+                return std::make_shared< JSONIOHandler >(
+                    path, access, std::move( options ), "cbor" );
+            case Format::JSON_MSGPACK:
+                return std::make_shared< JSONIOHandler >(
+                    path, access, std::move( options ), "msgpack" );
+            case Format::JSON_UBJSON:
+                return std::make_shared< JSONIOHandler >(
+                    path, access, std::move( options ), "ubjson" );
+            case Format::JSON_BSON:
+                return std::make_shared< JSONIOHandler >(
+                    path, access, std::move( options ), "bson" );
             default:
                 throw std::runtime_error(
                     "Unknown file format! Did you specify a file ending?" );
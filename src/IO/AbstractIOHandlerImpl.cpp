@@ -0,0 +1,297 @@
+/* Copyright 2021 The openPMD Community
+ *
+ * This file is part of openPMD-api.
+ *
+ * openPMD-api is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openPMD-api is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with openPMD-api.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "openPMD/IO/AbstractIOHandlerImpl.hpp"
+
+#include <cstring>
+#include <utility>
+#include <vector>
+
+
+namespace openPMD
+{
+namespace internal
+{
+namespace
+{
+    // upper bound for the buffer of a merged task
+    constexpr size_t maxCoalescedBytes = 16u * 1024u * 1024u;
+
+    size_t numElements( Extent const & extent )
+    {
+        size_t res = 1;
+        for( auto ext : extent )
+            res *= ext;
+        return res;
+    }
+
+    /** Check whether the hyperslab (nextOffset, nextExtent) continues
+     *  (offset, extent) such that the row-major buffer of their union is the
+     *  concatenation of both buffers.
+     *
+     * This is the case if they differ in exactly one dimension d, where the
+     * second one starts at the end of the first one, and all dimensions
+     * before d have an extent of one.
+     *
+     * @return The dimension d along which to merge, or -1.
+     */
+    int continuationDimension(
+        Offset const & offset,
+        Extent const & extent,
+        Offset const & nextOffset,
+        Extent const & nextExtent )
+    {
+        size_t const dims = offset.size();
+        if( dims == 0 || extent.size() != dims || nextOffset.size() != dims ||
+            nextExtent.size() != dims )
+        {
+            return -1;
+        }
+        for( size_t d = 0; d < dims; ++d )
+        {
+            if( offset[ d ] == nextOffset[ d ] && extent[ d ] == nextExtent[ d ] )
+            {
+                if( extent[ d ] != 1 )
+                    return -1;
+                continue;
+            }
+            if( offset[ d ] + extent[ d ] != nextOffset[ d ] )
+                return -1;
+            for( size_t e = d + 1; e < dims; ++e )
+            {
+                if( offset[ e ] != nextOffset[ e ] ||
+                    extent[ e ] != nextExtent[ e ] )
+                {
+                    return -1;
+                }
+            }
+            return static_cast< int >( d );
+        }
+        // identical hyperslabs
+        return -1;
+    }
+
+    template< Operation op >
+    Parameter< op > const & parameterOf( IOTask const & task )
+    {
+        return *static_cast< Parameter< op > const * >( task.parameter.get() );
+    }
+
+    template< Operation op >
+    size_t findRun(
+        std::vector< IOTask > const & tasks,
+        size_t begin,
+        Extent & mergedExtent )
+    {
+        auto const & first = parameterOf< op >( tasks[ begin ] );
+        size_t const elementSize = toBytes( first.dtype );
+        Offset const offset = first.offset;
+        mergedExtent = first.extent;
+        size_t numBytes = numElements( mergedExtent ) * elementSize;
+        if( numBytes == 0 || !first.data )
+            return begin + 1;
+
+        size_t end = begin + 1;
+        for( ; end < tasks.size(); ++end )
+        {
+            IOTask const & task = tasks[ end ];
+            if( task.operation != op || task.writable != tasks[ begin ].writable )
+                break;
+            auto const & param = parameterOf< op >( task );
+            if( param.dtype != first.dtype || !param.data )
+                break;
+            size_t const addBytes = numElements( param.extent ) * elementSize;
+            if( addBytes == 0 || numBytes + addBytes > maxCoalescedBytes )
+                break;
+            // the run so far spans (offset, mergedExtent)
+            int const d = continuationDimension(
+                offset, mergedExtent, param.offset, param.extent );
+            if( d < 0 )
+                break;
+            mergedExtent[ d ] += param.extent[ d ];
+            numBytes += addBytes;
+        }
+        return end;
+    }
+
+    void mergeWrites(
+        std::vector< IOTask > const & tasks,
+        size_t begin,
+        size_t end,
+        Extent extent,
+        std::queue< IOTask > & out )
+    {
+        auto const & first = parameterOf< Operation::WRITE_DATASET >( tasks[ begin ] );
+        size_t const elementSize = toBytes( first.dtype );
+        size_t const numBytes = numElements( extent ) * elementSize;
+        std::shared_ptr< char > buffer{
+            new char[ numBytes ], std::default_delete< char[] >() };
+        size_t pos = 0;
+        for( size_t i = begin; i < end; ++i )
+        {
+            auto const & param =
+                parameterOf< Operation::WRITE_DATASET >( tasks[ i ] );
+            size_t const bytes = numElements( param.extent ) * elementSize;
+            std::memcpy( buffer.get() + pos, param.data.get(), bytes );
+            pos += bytes;
+        }
+
+        Parameter< Operation::WRITE_DATASET > merged;
+        merged.offset = first.offset;
+        merged.extent = std::move( extent );
+        merged.dtype = first.dtype;
+        merged.data = std::move( buffer );
+        out.push( IOTask( tasks[ begin ].writable, merged ) );
+    }
+
+    void mergeReads(
+        std::vector< IOTask > const & tasks,
+        size_t begin,
+        size_t end,
+        Extent extent,
+        std::queue< IOTask > & out,
+        CoalescedReads & reads )
+    {
+        auto const & first = parameterOf< Operation::READ_DATASET >( tasks[ begin ] );
+        size_t const elementSize = toBytes( first.dtype );
+        size_t const numBytes = numElements( extent ) * elementSize;
+        CoalescedRead read;
+        read.scratch = std::shared_ptr< char >{
+            new char[ numBytes ], std::default_delete< char[] >() };
+        for( size_t i = begin; i < end; ++i )
+        {
+            auto const & param =
+                parameterOf< Operation::READ_DATASET >( tasks[ i ] );
+            read.targets.emplace_back(
+                param.data, numElements( param.extent ) * elementSize );
+        }
+
+        Parameter< Operation::READ_DATASET > merged;
+        merged.offset = first.offset;
+        merged.extent = std::move( extent );
+        merged.dtype = first.dtype;
+        merged.data = read.scratch;
+        out.push( IOTask( tasks[ begin ].writable, merged ) );
+        reads[ out.back().parameter.get() ] = std::move( read );
+    }
+} // namespace [anonymous]
+
+void CoalescedRead::scatter() const
+{
+    size_t pos = 0;
+    for( auto const & target : targets )
+    {
+        std::memcpy( target.first.get(), scratch.get() + pos, target.second );
+        pos += target.second;
+    }
+}
+
+uint64_t payloadBytes( IOTask const & task )
+{
+    switch( task.operation )
+    {
+        case Operation::WRITE_DATASET:
+        {
+            auto const & param = parameterOf< Operation::WRITE_DATASET >( task );
+            return numElements( param.extent ) * toBytes( param.dtype );
+        }
+        case Operation::READ_DATASET:
+        {
+            auto const & param = parameterOf< Operation::READ_DATASET >( task );
+            return numElements( param.extent ) * toBytes( param.dtype );
+        }
+        default:
+            return 0;
+    }
+}
+
+void coalesceDatasetTasks( std::queue< IOTask > & work, CoalescedReads * reads )
+{
+    if( work.size() < 2 )
+        return;
+
+    std::vector< IOTask > tasks;
+    tasks.reserve( work.size() );
+    while( !work.empty() )
+    {
+        tasks.emplace_back( work.front() );
+        work.pop();
+    }
+
+    for( size_t i = 0; i < tasks.size(); )
+    {
+        Extent extent;
+        size_t end = i + 1;
+        switch( tasks[ i ].operation )
+        {
+            case Operation::WRITE_DATASET:
+                end = findRun< Operation::WRITE_DATASET >( tasks, i, extent );
+                if( end - i > 1 )
+                    mergeWrites( tasks, i, end, std::move( extent ), work );
+                break;
+            case Operation::READ_DATASET:
+                if( !reads )
+                    break;
+                end = findRun< Operation::READ_DATASET >( tasks, i, extent );
+                if( end - i > 1 )
+                    mergeReads(
+                        tasks, i, end, std::move( extent ), work, *reads );
+                break;
+            default:
+                break;
+        }
+        if( end - i == 1 )
+            work.push( tasks[ i ] );
+        i = end;
+    }
+}
+} // namespace internal
+
+void
+AbstractIOHandlerImpl::prefetchFiles(
+    Writable *, Parameter< Operation::PREFETCH_FILES > const & )
+{
+}
+
+void
+AbstractIOHandlerImpl::readAttributes(
+    Writable * writable, Parameter< Operation::READ_ATTS > & parameters )
+{
+    Parameter< Operation::LIST_ATTS > aList;
+    listAttributes( writable, aList );
+
+    Parameter< Operation::READ_ATT > aRead;
+    for( auto const & name : *aList.attributes )
+    {
+        aRead.name = name;
+        try
+        {
+            readAttribute( writable, aRead );
+        }
+        catch( unsupported_data_error const & e )
+        {
+            ( *parameters.skipped )[ name ] = e.what();
+            continue;
+        }
+        ( *parameters.attributes )[ name ] =
+            std::make_pair( *aRead.dtype, *aRead.resource );
+    }
+}
+} // namespace openPMD
@@ -0,0 +1,305 @@
+/* Copyright 2021 The openPMD Community
+ *
+ * This file is part of openPMD-api.
+ *
+ * openPMD-api is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openPMD-api is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with openPMD-api.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "openPMD/IO/AsyncIOHandler.hpp"
+
+#include <iostream>
+#include <utility>
+#include <vector>
+
+
+namespace openPMD
+{
+namespace
+{
+    /** Operations whose effects are never inspected by the frontend directly
+     *  after a flush and which may hence complete in the background.
+     */
+    bool isDeferrable( Operation op )
+    {
+        switch( op )
+        {
+            case Operation::WRITE_DATASET:
+            case Operation::WRITE_ATT:
+            case Operation::CLOSE_PATH:
+            case Operation::CLOSE_FILE:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    /** Operations that a WRITE_DATASET task may be moved behind without
+     *  changing the outcome of either task.
+     */
+    bool isTransparentForWrites( Operation op )
+    {
+        switch( op )
+        {
+            case Operation::CREATE_PATH:
+            case Operation::CREATE_DATASET:
+            case Operation::OPEN_PATH:
+            case Operation::OPEN_DATASET:
+            case Operation::WRITE_DATASET:
+            case Operation::WRITE_ATT:
+            case Operation::READ_ATT:
+            case Operation::DELETE_ATT:
+            case Operation::LIST_PATHS:
+            case Operation::LIST_DATASETS:
+            case Operation::LIST_ATTS:
+            case Operation::READ_ATTS:
+                return true;
+            default:
+                return false;
+        }
+    }
+} // namespace [anonymous]
+
+AsyncIOHandler::AsyncIOHandler( std::shared_ptr< AbstractIOHandler > backend )
+    : AbstractIOHandler( backend->directory, backend->m_backendAccess )
+    , m_backend{ std::move( backend ) }
+{
+    m_tracer = m_backend->m_tracer;
+    m_worker = std::thread( [ this ]() { workerLoop(); } );
+}
+
+AsyncIOHandler::~AsyncIOHandler()
+{
+    try
+    {
+        awaitPendingFlush();
+    }
+    catch( std::exception const & ex )
+    {
+        std::cerr << "[" << backendName()
+                  << "] Error in asynchronous flush: " << ex.what()
+                  << std::endl;
+    }
+    catch( ... )
+    {
+        std::cerr << "[" << backendName()
+                  << "] Error in asynchronous flush." << std::endl;
+    }
+    {
+        std::lock_guard< std::mutex > lock( m_mutex );
+        m_shutdown = true;
+    }
+    m_wakeWorker.notify_one();
+    m_worker.join();
+}
+
+bool
+AsyncIOHandler::supportsPrefetch() const
+{
+    return m_backend->supportsPrefetch();
+}
+
+std::string
+AsyncIOHandler::backendName() const
+{
+    return m_backend->backendName();
+}
+
+std::future< void >
+AsyncIOHandler::flush()
+{
+    if( m_work.empty() )
+    {
+        /*
+         * Nothing new, hand out the outcome of the last flush instead.
+         * Its error stays in m_error until forwardErrorsToFuture() or the
+         * next flush.
+         */
+        std::promise< void > promise;
+        std::future< void > future = promise.get_future();
+        std::lock_guard< std::mutex > lock( m_mutex );
+        if( m_busy )
+            m_deferredPromises.emplace_back( std::move( promise ) );
+        else if( m_error )
+            promise.set_exception( m_error );
+        else
+            promise.set_value();
+        return future;
+    }
+
+    awaitPendingFlush();
+
+    std::vector< IOTask > tasks;
+    tasks.reserve( m_work.size() );
+    while( !m_work.empty() )
+    {
+        tasks.emplace_back( m_work.front() );
+        m_work.pop();
+    }
+
+    // everything up to the last non-deferrable task must run synchronously
+    size_t syncEnd = 0;
+    for( size_t i = 0; i < tasks.size(); ++i )
+    {
+        if( !isDeferrable( tasks[ i ].operation ) )
+            syncEnd = i + 1;
+    }
+
+    // except for writes that may be postponed until after that task
+    std::vector< bool > postpone( syncEnd, false );
+    bool blocked = false;
+    for( size_t i = syncEnd; i-- > 0; )
+    {
+        Operation op = tasks[ i ].operation;
+        if( op == Operation::WRITE_DATASET && !blocked )
+            postpone[ i ] = true;
+        else if( !isTransparentForWrites( op ) )
+            blocked = true;
+    }
+
+    std::queue< IOTask > sync;
+    std::queue< IOTask > deferred;
+    for( size_t i = 0; i < tasks.size(); ++i )
+    {
+        if( i < syncEnd && !postpone[ i ] )
+            sync.push( tasks[ i ] );
+        else
+            deferred.push( tasks[ i ] );
+    }
+
+    if( !sync.empty() )
+    {
+        try
+        {
+            process( std::move( sync ), m_flushLevel );
+        }
+        catch( ... )
+        {
+            // keep the deferred tasks for the next flush, as synchronous
+            // handlers would
+            m_work = std::move( deferred );
+            throw;
+        }
+    }
+
+    std::promise< void > promise;
+    std::future< void > future = promise.get_future();
+    if( deferred.empty() )
+    {
+        promise.set_value();
+        return future;
+    }
+    {
+        std::lock_guard< std::mutex > lock( m_mutex );
+        m_deferred = std::move( deferred );
+        m_deferredFlushLevel = m_flushLevel;
+        m_deferredPromises.emplace_back( std::move( promise ) );
+        m_busy = true;
+    }
+    m_wakeWorker.notify_one();
+    return future;
+}
+
+void
+AsyncIOHandler::awaitPendingFlush()
+{
+    std::unique_lock< std::mutex > lock( m_mutex );
+    m_jobDone.wait( lock, [ this ]() { return !m_busy; } );
+    if( m_error )
+    {
+        std::exception_ptr error;
+        std::swap( error, m_error );
+        std::rethrow_exception( error );
+    }
+}
+
+void
+AsyncIOHandler::forwardErrorsToFuture()
+{
+    std::lock_guard< std::mutex > lock( m_mutex );
+    if( m_busy )
+        m_errorForwarded = true;
+    else
+        // the flush has already completed, its future holds the error
+        m_error = nullptr;
+}
+
+IOStatistics
+AsyncIOHandler::statistics() const
+{
+    // the worker updates the backend's statistics, errors are left for
+    // the next flush to report
+    std::unique_lock< std::mutex > lock( m_mutex );
+    m_jobDone.wait( lock, [ this ]() { return !m_busy; } );
+    return m_backend->statistics();
+}
+
+void
+AsyncIOHandler::process( std::queue< IOTask > tasks, FlushLevel level )
+{
+    m_backend->m_flushLevel = level;
+    while( !tasks.empty() )
+    {
+        m_backend->enqueue( tasks.front() );
+        tasks.pop();
+    }
+    auto future = m_backend->flush();
+    if( future.valid() )
+        future.get();
+}
+
+void
+AsyncIOHandler::workerLoop()
+{
+    std::unique_lock< std::mutex > lock( m_mutex );
+    while( true )
+    {
+        m_wakeWorker.wait(
+            lock, [ this ]() { return m_busy || m_shutdown; } );
+        if( !m_busy )
+            return;
+
+        std::queue< IOTask > tasks = std::move( m_deferred );
+        m_deferred = std::queue< IOTask >();
+        FlushLevel level = m_deferredFlushLevel;
+        lock.unlock();
+
+        std::exception_ptr error;
+        try
+        {
+            process( std::move( tasks ), level );
+        }
+        catch( ... )
+        {
+            error = std::current_exception();
+        }
+
+        lock.lock();
+        for( auto & promise : m_deferredPromises )
+        {
+            if( error )
+                promise.set_exception( error );
+            else
+                promise.set_value();
+        }
+        m_deferredPromises.clear();
+        if( !m_errorForwarded )
+            m_error = error;
+        m_errorForwarded = false;
+        m_busy = false;
+        m_jobDone.notify_all();
+    }
+}
+} // namespace openPMD
@@ -31,7 +31,7 @@
 #   include <array>
 #   include <complex>
 #   include <map>
-#   include <stack>
+#   include <memory>
 #   include <stdexcept>
 #   include <string>
 #   include <typeinfo>
@@ -286,26 +286,28 @@ openPMD::getH5DataSpace(Attribute const& att)
     }
 }
 
-std::string
+std::atomic< uint64_t > openPMD::HDF5FilePosition::generation{ 0 };
+
+std::string const &
 openPMD::concrete_h5_file_position(Writable* w)
 {
-    std::stack< Writable* > hierarchy;
     if( !w->abstractFilePosition )
         w = w->parent;
-    while( w )
-    {
-        hierarchy.push(w);
-        w = w->parent;
-    }
 
-    std::string pos;
-    while( !hierarchy.empty() )
+    auto position =
+        static_cast< HDF5FilePosition* >(w->abstractFilePosition.get());
+    uint64_t const generation = HDF5FilePosition::generation.load();
+    // resolved paths are never empty
+    if( position->path.empty() || position->pathGeneration != generation )
     {
-        pos += std::dynamic_pointer_cast< HDF5FilePosition >(hierarchy.top()->abstractFilePosition)->location;
-        hierarchy.pop();
+        // resolves and caches the paths of the ancestors as well
+        std::string pos = w->parent
+            ? concrete_h5_file_position(w->parent) + position->location
+            : position->location;
+        position->path = auxiliary::replace_all(pos, "//", "/");
+        position->pathGeneration = generation;
     }
-
-    return auxiliary::replace_all(pos, "//", "/");
+    return position->path;
 }
 
 
@@ -25,19 +25,26 @@
 #if openPMD_HAVE_HDF5
 #   include "openPMD/Datatype.hpp"
 #   include "openPMD/auxiliary/Filesystem.hpp"
+#   include "openPMD/auxiliary/ParallelFor.hpp"
 #   include "openPMD/auxiliary/StringManip.hpp"
 #   include "openPMD/backend/Attribute.hpp"
 #   include "openPMD/IO/IOTask.hpp"
 #   include "openPMD/IO/HDF5/HDF5Auxiliary.hpp"
 #   include "openPMD/IO/HDF5/HDF5FilePosition.hpp"
+#   if openPMD_HAVE_ZLIB
+#       include <zlib.h>
+#   endif
 #endif
 
+#include <algorithm>
 #include <complex>
 #include <cstring>
 #include <future>
 #include <iostream>
+#include <map>
 #include <stack>
 #include <string>
+#include <thread>
 #include <typeinfo>
 #include <unordered_map>
 #include <utility>
@@ -86,11 +93,32 @@ HDF5IOHandlerImpl::HDF5IOHandlerImpl(
     H5Tinsert(m_H5T_CLONG_DOUBLE, "i", sizeof(long double), H5T_NATIVE_LDOUBLE);
 
     m_chunks = auxiliary::getEnvString( "OPENPMD_HDF5_CHUNKS", "auto" );
+    m_handleCacheSize = static_cast< size_t >( std::max( 0, auxiliary::getEnvNum(
+        "OPENPMD_HDF5_HANDLE_CACHE_SIZE",
+        static_cast< int >( m_handleCacheSize ) ) ) );
+    m_directChunkWrite = auxiliary::getEnvString(
+        "OPENPMD_HDF5_DIRECT_CHUNK_WRITE", "OFF" ) == "ON";
     // JSON option can overwrite env option:
     if( config.contains( "hdf5" ) )
     {
         m_config = std::move( config[ "hdf5" ] );
 
+        if( m_config.json().contains( "handle_cache_size" ) )
+        {
+            m_handleCacheSize =
+                m_config[ "handle_cache_size" ].json().get< size_t >();
+        }
+        if( m_config.json().contains( "direct_chunk_write" ) )
+        {
+            m_directChunkWrite =
+                m_config[ "direct_chunk_write" ].json().get< bool >();
+        }
+        if( m_config.json().contains( "compression_threads" ) )
+        {
+            m_compressionThreads =
+                m_config[ "compression_threads" ].json().get< unsigned >();
+        }
+
         // check for global dataset configs
         if( m_config.json().contains( "dataset" ) )
         {
@@ -99,6 +127,11 @@ HDF5IOHandlerImpl::HDF5IOHandlerImpl(
             {
                 m_chunks = datasetConfig[ "chunks" ].json().get< std::string >();
             }
+            auto filters = getFilters( datasetConfig );
+            if( filters )
+            {
+                m_filters = std::move( filters.get() );
+            }
         }
         if( m_chunks != "auto" && m_chunks != "none" )
         {
@@ -117,6 +150,110 @@ HDF5IOHandlerImpl::HDF5IOHandlerImpl(
                       << shadow << std::endl;
         }
     }
+
+#if !H5_VERSION_GE(1,10,3)
+    if( m_directChunkWrite )
+    {
+        std::cerr << "Warning: HDF5 direct chunk writes require HDF5 1.10.3 "
+                     "or newer and are disabled." << std::endl;
+        m_directChunkWrite = false;
+    }
+#endif
+}
+
+auxiliary::Option< std::vector< HDF5IOHandlerImpl::Filter > >
+HDF5IOHandlerImpl::getFilters( auxiliary::TracingJSON datasetConfig )
+{
+    using ret_t = auxiliary::Option< std::vector< Filter > >;
+    if( !datasetConfig.json().contains( "filters" ) )
+    {
+        return ret_t();
+    }
+
+    // predefined filters and registered ones that are commonly installed
+    // as plugins, see https://portal.hdfgroup.org/display/support/Filters
+    static std::map< std::string, H5Z_filter_t > const knownFilters{
+        { "deflate", H5Z_FILTER_DEFLATE },
+        { "zlib", H5Z_FILTER_DEFLATE },
+        { "shuffle", H5Z_FILTER_SHUFFLE },
+        { "fletcher32", H5Z_FILTER_FLETCHER32 },
+        { "szip", H5Z_FILTER_SZIP },
+        { "nbit", H5Z_FILTER_NBIT },
+        { "scaleoffset", H5Z_FILTER_SCALEOFFSET },
+        { "bzip2", 307 },
+        { "lzf", 32000 },
+        { "blosc", 32001 },
+        { "lz4", 32004 },
+        { "bitshuffle", 32008 },
+        { "zfp", 32013 },
+        { "zstd", 32015 } };
+
+    auto _filters = datasetConfig[ "filters" ];
+    if( !_filters.json().is_array() )
+    {
+        throw std::runtime_error(
+            "[HDF5] The filters must be given as a list of objects." );
+    }
+    std::vector< Filter > res;
+    // index the entries so that unused keys within them are reported
+    for( size_t i = 0; i < _filters.json().size(); ++i )
+    {
+        auto filter = _filters[ i ];
+        Filter f;
+        nlohmann::json const & type = filter[ "type" ].json();
+        if( type.is_string() )
+        {
+            f.name = type.get< std::string >();
+            auto it = knownFilters.find( f.name );
+            if( it == knownFilters.end() )
+            {
+                throw std::runtime_error(
+                    "[HDF5] Unknown filter '" + f.name +
+                    "', specify it by its registered filter ID instead." );
+            }
+            f.id = it->second;
+        }
+        else
+        {
+            f.id = type.get< H5Z_filter_t >();
+            f.name = std::to_string( f.id );
+        }
+        if( filter.json().contains( "parameters" ) )
+        {
+            f.parameters = filter[ "parameters" ]
+                               .json()
+                               .get< std::vector< unsigned > >();
+        }
+        f.flags = filter.json().contains( "optional" ) &&
+                filter[ "optional" ].json().get< bool >()
+            ? H5Z_FLAG_OPTIONAL
+            : H5Z_FLAG_MANDATORY;
+
+        /*
+         * Registered filters are loaded from HDF5_PLUGIN_PATH upon first
+         * use, so a missing plugin would otherwise only surface as a failure
+         * to create the dataset.
+         */
+        unsigned config = 0;
+        if( H5Zfilter_avail( f.id ) <= 0 ||
+            H5Zget_filter_info( f.id, &config ) < 0 ||
+            !( config & H5Z_FILTER_CONFIG_ENCODE_ENABLED ) )
+        {
+            std::string const message = "Filter '" + f.name + "' (ID " +
+                std::to_string( f.id ) +
+                ") is not available for writing. HDF5 loads filter plugins "
+                "from the directories in HDF5_PLUGIN_PATH.";
+            if( f.flags == H5Z_FLAG_MANDATORY )
+            {
+                throw std::runtime_error( "[HDF5] " + message );
+            }
+            std::cerr << "Warning: HDF5 " << message
+                      << " Skipping the optional filter." << std::endl;
+            continue;
+        }
+        res.push_back( std::move( f ) );
+    }
+    return auxiliary::makeOption( std::move( res ) );
 }
 
 HDF5IOHandlerImpl::~HDF5IOHandlerImpl()
@@ -135,6 +272,7 @@ HDF5IOHandlerImpl::~HDF5IOHandlerImpl()
     if( status < 0 )
         std::cerr << "[HDF5] Internal error: Failed to close complex long double type\n";
 
+    closeHandles( -1 );
     while( !m_openFileIDs.empty() )
     {
         auto file = m_openFileIDs.begin();
@@ -187,7 +325,7 @@ HDF5IOHandlerImpl::createFile(Writable* writable,
         VERIFY(id >= 0, "[HDF5] Internal error: Failed to create HDF5 file");
 
         writable->written = true;
-        writable->abstractFilePosition = std::make_shared< HDF5FilePosition >("/");
+        setFilePosition(writable, std::make_shared< HDF5FilePosition >("/"));
 
         m_fileNames[writable] = name;
         m_fileNamesWithID[std::move(name)]=id;
@@ -218,22 +356,21 @@ HDF5IOHandlerImpl::createPath(Writable* writable,
         else
             position = writable; /* root does not have a parent but might still have to be written */
         File file = getFile( position ).get();
-        hid_t node_id = H5Gopen(file.id,
-                                concrete_h5_file_position(position).c_str(),
-                                H5P_DEFAULT);
+        hid_t node_id = obtainHandle(file.id,
+                                     concrete_h5_file_position(position));
         VERIFY(node_id >= 0, "[HDF5] Internal error: Failed to open HDF5 group during path creation");
 
         /* Create the path in the file */
         std::stack< hid_t > groups;
-        groups.push(node_id);
         for( std::string const& folder : auxiliary::split(path, "/", false) )
         {
+            hid_t const parent = groups.empty() ? node_id : groups.top();
             // avoid creation of paths that already exist
-            htri_t const found = H5Lexists(groups.top(), folder.c_str(), H5P_DEFAULT);
+            htri_t const found = H5Lexists(parent, folder.c_str(), H5P_DEFAULT);
             if (found > 0)
               continue;
 
-            hid_t group_id = H5Gcreate(groups.top(),
+            hid_t group_id = H5Gcreate(parent,
                                        folder.c_str(),
                                        H5P_DEFAULT,
                                        H5P_DEFAULT,
@@ -252,7 +389,7 @@ HDF5IOHandlerImpl::createPath(Writable* writable,
         }
 
         writable->written = true;
-        writable->abstractFilePosition = std::make_shared< HDF5FilePosition >(path);
+        setFilePosition(writable, std::make_shared< HDF5FilePosition >(path));
 
         m_fileNames[writable] = file.name;
     }
@@ -283,6 +420,20 @@ HDF5IOHandlerImpl::createDataset(Writable* writable,
             is_resizable_dataset = config.at( "resizable" ).get< bool >();
         }
 
+        /*
+         * Chunking, in order of precedence: per-dataset JSON config,
+         * Dataset::setChunkSize(), global JSON config.
+         */
+        std::string chunks = m_chunks;
+        std::vector< hsize_t > chunk_dims;
+        if( parameters.chunkSizeSpecified )
+        {
+            chunk_dims.assign(
+                parameters.chunkSize.begin(), parameters.chunkSize.end() );
+        }
+
+        std::vector< Filter > filters = m_filters;
+
         // HDF5 specific
         if( config.contains( "hdf5" ) &&
             config[ "hdf5" ].contains( "dataset" ) )
@@ -290,9 +441,34 @@ HDF5IOHandlerImpl::createDataset(Writable* writable,
             auxiliary::TracingJSON datasetConfig{
                 config[ "hdf5" ][ "dataset" ] };
 
-            /*
-             * @todo Read more options from config here.
-             */
+            if( datasetConfig.json().contains( "chunks" ) )
+            {
+                auto const & chunksConfig = datasetConfig[ "chunks" ].json();
+                if( chunksConfig.is_array() )
+                {
+                    chunk_dims = chunksConfig.get< std::vector< hsize_t > >();
+                }
+                else
+                {
+                    chunks = chunksConfig.get< std::string >();
+                    if( chunks != "auto" && chunks != "none" )
+                    {
+                        throw std::runtime_error(
+                            "[HDF5] Invalid chunking option '" + chunks +
+                            "' for dataset '" + name +
+                            "', must be \"auto\", \"none\" or a list of "
+                            "chunk dimensions." );
+                    }
+                    chunk_dims.clear();
+                }
+            }
+
+            auto datasetFilters = getFilters( datasetConfig );
+            if( datasetFilters )
+            {
+                filters = std::move( datasetFilters.get() );
+            }
+
             auto shadow = datasetConfig.invertShadow();
             if( shadow.size() > 0 )
             {
@@ -303,12 +479,68 @@ HDF5IOHandlerImpl::createDataset(Writable* writable,
             }
         }
 
+        bool const empty = std::find(
+            parameters.extent.begin(), parameters.extent.end(), 0u ) !=
+            parameters.extent.end();
+        if( !chunk_dims.empty() )
+        {
+            bool valid = chunk_dims.size() == parameters.extent.size();
+            for( size_t i = 0; valid && i < chunk_dims.size(); ++i )
+            {
+                valid = chunk_dims[i] > 0u &&
+                    ( is_resizable_dataset ||
+                      chunk_dims[i] <= parameters.extent[i] );
+            }
+            if( empty && !is_resizable_dataset )
+            {
+                // nothing to chunk in an empty dataset of fixed size
+                chunk_dims.clear();
+            }
+            else if( !valid )
+            {
+                throw std::runtime_error(
+                    "[HDF5] Chunk dimensions for dataset '" + name +
+                    "' must be positive, match the dimensionality of the "
+                    "dataset and not exceed its extent (unless resizable)." );
+            }
+        }
+
+        std::string const& compression = parameters.compression;
+        if( !compression.empty() )
+        {
+            std::vector< std::string > args = auxiliary::split(compression, ":");
+            std::string const& format = args[0];
+            if( (format == "zlib" || format == "gzip" || format == "deflate")
+                && args.size() == 2 )
+            {
+                filters.push_back( Filter{
+                    H5Z_FILTER_DEFLATE,
+                    format,
+                    H5Z_FLAG_MANDATORY,
+                    { static_cast< unsigned >( std::stoi(args[1]) ) } } );
+            }
+            else
+                std::cerr << "[HDF5] Compression format " << format
+                          << " unknown, use the hdf5.dataset.filters "
+                             "configuration instead. Data will not be "
+                             "compressed!"
+                          << std::endl;
+        }
+
+        // filters can only be applied to chunked datasets
+        if( !filters.empty() && chunk_dims.empty() && chunks == "none" &&
+            !empty )
+        {
+            throw std::runtime_error(
+                "[HDF5] Filters for dataset '" + name +
+                "' require chunking, but chunking is disabled." );
+        }
+
         /* Open H5Object to write into */
         auto res = getFile( writable );
         File file = res ? res.get() : getFile( writable->parent ).get();
-        hid_t node_id = H5Gopen(file.id,
-                                concrete_h5_file_position(writable).c_str(),
-                                H5P_DEFAULT);
+        hid_t node_id = obtainHandle(file.id,
+                                     concrete_h5_file_position(writable));
         VERIFY(node_id >= 0, "[HDF5] Internal error: Failed to open HDF5 group during dataset creation");
 
         Datatype d = parameters.dtype;
@@ -337,44 +569,30 @@ HDF5IOHandlerImpl::createDataset(Writable* writable,
         /* enable chunking on the created dataspace */
         hid_t datasetCreationProperty = H5Pcreate(H5P_DATASET_CREATE);
 
-        if( num_elements != 0u && m_chunks != "none" )
+        if( chunk_dims.empty() && num_elements != 0u && chunks != "none" )
         {
-            //! @todo add per dataset chunk control from JSON config
-
             // get chunking dimensions
-            std::vector< hsize_t > chunk_dims = getOptimalChunkDims(dims, toBytes(d));
-
-            //! @todo allow overwrite with user-provided chunk size
-            //for( auto const& val : parameters.chunkSize )
-            //    chunk_dims.push_back(static_cast< hsize_t >(val));
+            chunk_dims = getOptimalChunkDims(dims, toBytes(d));
+        }
 
+        if( !chunk_dims.empty() )
+        {
             herr_t status = H5Pset_chunk(datasetCreationProperty, chunk_dims.size(), chunk_dims.data());
             VERIFY(status == 0, "[HDF5] Internal error: Failed to set chunk size during dataset creation");
         }
 
-        std::string const& compression = parameters.compression;
-        if( !compression.empty() )
-          std::cerr << "[HDF5] Compression not yet implemented in HDF5 backend."
-                    << std::endl;
-        /*
-        {
-            std::vector< std::string > args = auxiliary::split(compression, ":");
-            std::string const& format = args[0];
-            if( (format == "zlib" || format == "gzip" || format == "deflate")
-                && args.size() == 2 )
-            {
-                status = H5Pset_deflate(datasetCreationProperty, std::stoi(args[1]));
-                VERIFY(status == 0, "[HDF5] Internal error: Failed to set deflate compression during dataset creation");
-            } else if( format == "szip" || format == "nbit" || format == "scaleoffset" )
-                std::cerr << "[HDF5] Compression format " << format
-                          << " not yet implemented. Data will not be compressed!"
-                          << std::endl;
-            else
-                std::cerr << "[HDF5] Compression format " << format
-                          << " unknown. Data will not be compressed!"
-                          << std::endl;
+        // nothing to filter in an empty dataset of fixed size
+        for( size_t i = 0; i < filters.size() && !chunk_dims.empty(); ++i )
+        {
+            Filter const & f = filters[ i ];
+            herr_t status = H5Pset_filter(
+                datasetCreationProperty,
+                f.id,
+                f.flags,
+                f.parameters.size(),
+                f.parameters.data() );
+            VERIFY(status == 0, "[HDF5] Internal error: Failed to set filter '" + f.name + "' during dataset creation");
         }
-         */
 
         std::string const& transform = parameters.transform;
         if( !transform.empty() )
@@ -407,11 +625,9 @@ HDF5IOHandlerImpl::createDataset(Writable* writable,
         VERIFY(status == 0, "[HDF5] Internal error: Failed to close HDF5 dataset creation property during dataset creation");
         status = H5Sclose(space);
         VERIFY(status == 0, "[HDF5] Internal error: Failed to close HDF5 dataset space during dataset creation");
-        status = H5Gclose(node_id);
-        VERIFY(status == 0, "[HDF5] Internal error: Failed to close HDF5 group during dataset creation");
 
         writable->written = true;
-        writable->abstractFilePosition = std::make_shared< HDF5FilePosition >(name);
+        setFilePosition(writable, std::make_shared< HDF5FilePosition >(name));
 
         m_fileNames[writable] = file.name;
     }
@@ -430,9 +646,8 @@ HDF5IOHandlerImpl::extendDataset(Writable* writable,
     auto res = getFile( writable );
     if( !res )
         res = getFile( writable->parent );
-    hid_t dataset_id = H5Dopen(res.get().id,
-                         concrete_h5_file_position(writable).c_str(),
-                         H5P_DEFAULT);
+    hid_t dataset_id = obtainHandle(res.get().id,
+                                    concrete_h5_file_position(writable));
     VERIFY(dataset_id >= 0, "[HDF5] Internal error: Failed to open HDF5 dataset during dataset extension");
 
     // Datasets may only be extended if they have chunked layout, so let's see
@@ -463,9 +678,6 @@ HDF5IOHandlerImpl::extendDataset(Writable* writable,
     herr_t status;
     status = H5Dset_extent(dataset_id, size.data());
     VERIFY(status == 0, "[HDF5] Internal error: Failed to extend HDF5 dataset during dataset extension");
-
-    status = H5Dclose(dataset_id);
-    VERIFY(status == 0, "[HDF5] Internal error: Failed to close HDF5 dataset during dataset extension");
 }
 
 void
@@ -480,10 +692,8 @@ HDF5IOHandlerImpl::availableChunks(
     VERIFY( fid != m_fileNamesWithID.end(),
             "[HDF5] File ID not found with file name" );
 
-    hid_t dataset_id = H5Dopen(
-        fid->second,
-        concrete_h5_file_position( writable ).c_str(),
-        H5P_DEFAULT );
+    hid_t dataset_id = obtainHandle(
+        fid->second, concrete_h5_file_position( writable ) );
     VERIFY(
         dataset_id >= 0,
         "[HDF5] Internal error: Failed to open HDF5 dataset during dataset "
@@ -496,28 +706,132 @@ HDF5IOHandlerImpl::availableChunks(
         "dataset "
         "during dataset read." );
 
-    // // now let's figure out whether this one has chunks
-    // hid_t propertyList = H5Dget_create_plist( dataset_id );
-    // std::vector< hsize_t > chunkExtent( ndims, 0 );
-    // int chunkDimensionality =
-    //     H5Pget_chunk( propertyList, ndims, chunkExtent.data() );
-
-    // if( chunkDimensionality >= 0 )
-    // {
-    //     /*
-    //      * so, the dataset indeed has chunks
-    //      * alas, this backend doesn't write chunks, so for now, reading them
-    //      * is unimplemented
-    //      *
-    //      * https://hdf5.io/develop/group___h5_d.html#gaccff213d3e0765b86f66d08dd9959807
-    //      * May or may not be helpful if implementing this properly one day.
-    //      */
-    // }
-
     std::vector< hsize_t > dims( ndims, 0 );
     // return value is equal to ndims
     H5Sget_simple_extent_dims( dataset_space, dims.data(), nullptr );
 
+    // now let's figure out whether this one has chunks
+    hid_t propertyList = H5Dget_create_plist( dataset_id );
+    VERIFY(
+        propertyList >= 0,
+        "[HDF5] Internal error: Failed to get dataset creation property list "
+        "during chunk query" );
+    std::vector< hsize_t > chunkDims;
+    if( H5Pget_layout( propertyList ) == H5D_CHUNKED )
+    {
+        chunkDims.resize( ndims, 0 );
+        int chunkDimensionality =
+            H5Pget_chunk( propertyList, ndims, chunkDims.data() );
+        if( chunkDimensionality != ndims )
+            chunkDims.clear();
+    }
+    herr_t status = H5Pclose( propertyList );
+    VERIFY(
+        status == 0,
+        "[HDF5] Internal error: Failed to close dataset creation property list "
+        "during chunk query" );
+
+#if H5_VERSION_GE(1,10,5)
+    if( !chunkDims.empty() )
+    {
+        /*
+         * Report the chunks that have been allocated in the file, i.e. have
+         * been written to, clipped to the current extent of the dataset.
+         */
+        hsize_t numChunks = 0;
+        status = H5Dget_num_chunks( dataset_id, dataset_space, &numChunks );
+        VERIFY(
+            status == 0,
+            "[HDF5] Internal error: Failed to get number of chunks during "
+            "chunk query" );
+        auto addChunk = [ & ]( std::vector< hsize_t > const & chunkOffset ) {
+            Offset offset( ndims );
+            Extent extent( ndims );
+            for( int d = 0; d < ndims; ++d )
+            {
+                if( chunkOffset[ d ] >= dims[ d ] )
+                    return;
+                offset[ d ] = chunkOffset[ d ];
+                extent[ d ] =
+                    std::min( chunkDims[ d ], dims[ d ] - chunkOffset[ d ] );
+            }
+            parameters.chunks->push_back(
+                WrittenChunkInfo( std::move( offset ), std::move( extent ) ) );
+        };
+
+        /*
+         * Looking up a chunk by its index iterates the chunk index up to
+         * there, i.e. enumerating all chunks this way is quadratic.
+         * Unless the dataset is written very sparsely, it is much cheaper to
+         * look up each chunk of the grid by its coordinates instead.
+         */
+        hsize_t gridChunks = numChunks > 0 ? 1 : 0;
+        for( int d = 0; d < ndims && gridChunks <= 16 * numChunks; ++d )
+            gridChunks *= ( dims[ d ] + chunkDims[ d ] - 1 ) / chunkDims[ d ];
+
+        std::vector< hsize_t > chunkOffset( ndims, 0 );
+        unsigned filterMask;
+        haddr_t address;
+        hsize_t size;
+        if( gridChunks <= 16 * numChunks )
+        {
+            /*
+             * Some HDF5 versions fail for chunks that have not been allocated
+             * instead of reporting a size of zero, so silence the error stack.
+             */
+            H5E_BEGIN_TRY
+            {
+                for( hsize_t i = 0; i < gridChunks; ++i )
+                {
+                    size = 0;
+                    status = H5Dget_chunk_storage_size(
+                        dataset_id, chunkOffset.data(), &size );
+                    if( status >= 0 && size > 0 )
+                        addChunk( chunkOffset );
+                    // advance to the next chunk in row-major order
+                    for( int d = ndims - 1; d >= 0; --d )
+                    {
+                        chunkOffset[ d ] += chunkDims[ d ];
+                        if( chunkOffset[ d ] < dims[ d ] )
+                            break;
+                        chunkOffset[ d ] = 0;
+                    }
+                }
+            }
+            H5E_END_TRY;
+        }
+        else
+        {
+            for( hsize_t i = 0; i < numChunks; ++i )
+            {
+                status = H5Dget_chunk_info(
+                    dataset_id,
+                    dataset_space,
+                    i,
+                    chunkOffset.data(),
+                    &filterMask,
+                    &address,
+                    &size );
+                VERIFY(
+                    status >= 0,
+                    "[HDF5] Internal error: Failed to get chunk info during "
+                    "chunk query" );
+                addChunk( chunkOffset );
+            }
+        }
+        status = H5Sclose( dataset_space );
+        VERIFY(
+            status == 0,
+            "[HDF5] Internal error: Failed to close dataset space during "
+            "chunk query" );
+        return;
+    }
+#endif
+
+    /*
+     * Contiguous and compact datasets (or chunked ones with an HDF5 that
+     * cannot enumerate chunks) are reported as one large chunk.
+     */
     Offset offset( ndims, 0 );
     Extent extent;
     extent.reserve( ndims );
@@ -527,6 +841,11 @@ HDF5IOHandlerImpl::availableChunks(
     }
     parameters.chunks->push_back(
         WrittenChunkInfo( std::move( offset ), std::move( extent ) ) );
+    status = H5Sclose( dataset_space );
+    VERIFY(
+        status == 0,
+        "[HDF5] Internal error: Failed to close dataset space during "
+        "chunk query" );
 }
 
 void
@@ -566,7 +885,7 @@ HDF5IOHandlerImpl::openFile(
         throw no_such_file_error("[HDF5] Failed to open HDF5 file " + name);
 
     writable->written = true;
-    writable->abstractFilePosition = std::make_shared< HDF5FilePosition >("/");
+    setFilePosition(writable, std::make_shared< HDF5FilePosition >("/"));
 
     m_fileNamesWithID.erase(name);
     m_fileNamesWithID.insert({std::move(name), file_id});
@@ -587,6 +906,7 @@ HDF5IOHandlerImpl::closeFile(
         return;
     }
     File file = optionalFile.get();
+    closeHandles( file.id );
     H5Fclose( file.id );
     m_openFileIDs.erase( file.id );
     m_fileNames.erase( writable );
@@ -629,7 +949,7 @@ HDF5IOHandlerImpl::openPath(
     VERIFY(status == 0, "[HDF5] Internal error: Failed to close HDF5 group during path opening");
 
     writable->written = true;
-    writable->abstractFilePosition = std::make_shared< HDF5FilePosition >(path);
+    setFilePosition(writable, std::make_shared< HDF5FilePosition >(path));
 
     m_fileNames.erase(writable);
     m_fileNames.insert({writable, file.name});
@@ -734,7 +1054,7 @@ HDF5IOHandlerImpl::openDataset(Writable* writable,
     VERIFY(status == 0, "[HDF5] Internal error: Failed to close HDF5 group during dataset opening");
 
     writable->written = true;
-    writable->abstractFilePosition = std::make_shared< HDF5FilePosition >(name);
+    setFilePosition(writable, std::make_shared< HDF5FilePosition >(name));
 
     m_fileNames[writable] = file.name;
 }
@@ -749,6 +1069,7 @@ HDF5IOHandlerImpl::deleteFile(Writable* writable,
     if( writable->written )
     {
         hid_t file_id = getFile( writable ).get().id;
+        closeHandles( file_id );
         herr_t status = H5Fclose(file_id);
         VERIFY(status == 0, "[HDF5] Internal error: Failed to close HDF5 file during file deletion");
 
@@ -762,7 +1083,7 @@ HDF5IOHandlerImpl::deleteFile(Writable* writable,
         auxiliary::remove_file(name);
 
         writable->written = false;
-        writable->abstractFilePosition.reset();
+        setFilePosition(writable, nullptr);
 
         m_openFileIDs.erase(file_id);
         m_fileNames.erase(writable);
@@ -805,9 +1126,11 @@ HDF5IOHandlerImpl::deletePath(Writable* writable,
 
         status = H5Gclose(node_id);
         VERIFY(status == 0, "[HDF5] Internal error: Failed to close HDF5 group during path deletion");
+        // cached handles may refer to the deleted objects
+        closeHandles( file.id );
 
         writable->written = false;
-        writable->abstractFilePosition.reset();
+        setFilePosition(writable, nullptr);
 
         m_fileNames.erase(writable);
     }
@@ -848,9 +1171,11 @@ HDF5IOHandlerImpl::deleteDataset(Writable* writable,
 
         status = H5Gclose(node_id);
         VERIFY(status == 0, "[HDF5] Internal error: Failed to close HDF5 group during dataset deletion");
+        // cached handles may refer to the deleted objects
+        closeHandles( file.id );
 
         writable->written = false;
-        writable->abstractFilePosition.reset();
+        setFilePosition(writable, nullptr);
 
         m_fileNames.erase(writable);
     }
@@ -896,9 +1221,7 @@ HDF5IOHandlerImpl::writeDataset(Writable* writable,
 
     hid_t dataset_id, filespace, memspace;
     herr_t status;
-    dataset_id = H5Dopen(file.id,
-                         concrete_h5_file_position(writable).c_str(),
-                         H5P_DEFAULT);
+    dataset_id = obtainHandle(file.id, concrete_h5_file_position(writable));
     VERIFY(dataset_id >= 0, "[HDF5] Internal error: Failed to open HDF5 dataset during dataset write");
 
     std::vector< hsize_t > start;
@@ -953,6 +1276,8 @@ HDF5IOHandlerImpl::writeDataset(Writable* writable,
         case DT::CHAR:
         case DT::UCHAR:
         case DT::BOOL:
+            if( writeChunksDirectly( dataset_id, dataType, parameters ) )
+                break;
             status = H5Dwrite(dataset_id,
                               dataType,
                               memspace,
@@ -974,12 +1299,246 @@ HDF5IOHandlerImpl::writeDataset(Writable* writable,
     VERIFY(status == 0, "[HDF5] Internal error: Failed to close dataset file space during dataset write");
     status = H5Sclose(memspace);
     VERIFY(status == 0, "[HDF5] Internal error: Failed to close dataset memory space during dataset write");
-    status = H5Dclose(dataset_id);
-    VERIFY(status == 0, "[HDF5] Internal error: Failed to close dataset " + concrete_h5_file_position(writable) + " during dataset write");
 
     m_fileNames[writable] = file.name;
 }
 
+bool
+HDF5IOHandlerImpl::writeChunksDirectly(
+    hid_t dataset,
+    hid_t dataType,
+    Parameter< Operation::WRITE_DATASET > const & parameters )
+{
+#if H5_VERSION_GE(1,10,3)
+    size_t const ndims = parameters.extent.size();
+    if( !m_directChunkWrite || ndims == 0 )
+        return false;
+    for( auto ext : parameters.extent )
+        if( ext == 0 )
+            return false;
+
+    hid_t propertyList = H5Dget_create_plist( dataset );
+    VERIFY(propertyList >= 0, "[HDF5] Internal error: Failed to get HDF5 dataset creation property during dataset write");
+    bool supported = H5Pget_layout( propertyList ) == H5D_CHUNKED;
+    std::vector< hsize_t > chunkDims( ndims );
+    if( supported )
+    {
+        supported = H5Pget_chunk(
+            propertyList, static_cast< int >( ndims ), chunkDims.data() ) ==
+            static_cast< int >( ndims );
+    }
+
+    /*
+     * The pipeline as applied by HDF5, in order.
+     * Only filters implemented below can be applied here.
+     */
+    struct Stage
+    {
+        H5Z_filter_t id;
+        unsigned level; //!< deflate only
+    };
+    std::vector< Stage > pipeline;
+    int const numFilters = supported ? H5Pget_nfilters( propertyList ) : 0;
+    for( int i = 0; i < numFilters && supported; ++i )
+    {
+        unsigned flags = 0;
+        size_t numValues = 1;
+        unsigned values[ 1 ] = { 0 };
+        H5Z_filter_t id = H5Pget_filter2(
+            propertyList,
+            static_cast< unsigned >( i ),
+            &flags,
+            &numValues,
+            values,
+            0,
+            nullptr,
+            nullptr );
+        if( id == H5Z_FILTER_SHUFFLE )
+            pipeline.push_back( Stage{ id, 0 } );
+#if openPMD_HAVE_ZLIB
+        else if( id == H5Z_FILTER_DEFLATE && numValues >= 1 )
+            pipeline.push_back( Stage{ id, values[ 0 ] } );
+#endif
+        else
+            supported = false;
+    }
+    herr_t status = H5Pclose( propertyList );
+    VERIFY(status == 0, "[HDF5] Internal error: Failed to close HDF5 dataset creation property during dataset write");
+    if( !supported )
+        return false;
+
+    // chunks are stored in the datatype of the file, without conversion
+    hid_t fileType = H5Dget_type( dataset );
+    VERIFY(fileType >= 0, "[HDF5] Internal error: Failed to get HDF5 datatype during dataset write");
+    bool const sameType = H5Tequal( fileType, dataType ) > 0;
+    size_t const elementSize = H5Tget_size( fileType );
+    status = H5Tclose( fileType );
+    VERIFY(status == 0, "[HDF5] Internal error: Failed to close HDF5 datatype during dataset write");
+    if( !sameType )
+        return false;
+
+    hid_t dataspace = H5Dget_space( dataset );
+    VERIFY(dataspace >= 0, "[HDF5] Internal error: Failed to get HDF5 dataspace during dataset write");
+    std::vector< hsize_t > datasetExtent( ndims );
+    H5Sget_simple_extent_dims( dataspace, datasetExtent.data(), nullptr );
+    status = H5Sclose( dataspace );
+    VERIFY(status == 0, "[HDF5] Internal error: Failed to close HDF5 dataspace during dataset write");
+
+    /*
+     * The block must cover whole chunks, since a chunk is written as a
+     * whole. Chunks at the end of the dataset only need to be covered up to
+     * the end of the dataset.
+     */
+    std::vector< size_t > chunksPerDim( ndims );
+    size_t numChunks = 1;
+    for( size_t d = 0; d < ndims; ++d )
+    {
+        hsize_t const end = parameters.offset[ d ] + parameters.extent[ d ];
+        if( parameters.offset[ d ] % chunkDims[ d ] != 0 ||
+            ( end % chunkDims[ d ] != 0 && end != datasetExtent[ d ] ) )
+            return false;
+        chunksPerDim[ d ] =
+            ( parameters.extent[ d ] + chunkDims[ d ] - 1 ) / chunkDims[ d ];
+        numChunks *= chunksPerDim[ d ];
+    }
+
+    size_t chunkElements = 1;
+    for( auto dim : chunkDims )
+        chunkElements *= dim;
+    size_t const chunkBytes = chunkElements * elementSize;
+    char const * const data =
+        static_cast< char const * >( parameters.data.get() );
+
+    /*
+     * Copy the chunk with the given index within the block out of the
+     * block, padding it with zeros beyond the end of the dataset, and run
+     * the pipeline on it.
+     */
+    auto filterChunk = [ & ]( size_t chunk, std::vector< hsize_t > & chunkOffset )
+    {
+        std::vector< hsize_t > start( ndims ); // within the block
+        std::vector< hsize_t > count( ndims ); // covered by the block
+        for( size_t d = ndims; d-- > 0; )
+        {
+            start[ d ] = chunk % chunksPerDim[ d ] * chunkDims[ d ];
+            chunk /= chunksPerDim[ d ];
+            count[ d ] = std::min(
+                chunkDims[ d ],
+                static_cast< hsize_t >( parameters.extent[ d ] ) - start[ d ] );
+            chunkOffset[ d ] = parameters.offset[ d ] + start[ d ];
+        }
+
+        std::vector< char > buffer( chunkBytes, 0 );
+        size_t const rowBytes = count[ ndims - 1 ] * elementSize;
+        std::vector< hsize_t > index( ndims, 0 ); // row within the chunk
+        while( true )
+        {
+            size_t blockPos = 0;
+            size_t chunkPos = 0;
+            for( size_t d = 0; d < ndims; ++d )
+            {
+                blockPos = blockPos * parameters.extent[ d ] +
+                    start[ d ] + index[ d ];
+                chunkPos = chunkPos * chunkDims[ d ] + index[ d ];
+            }
+            std::memcpy(
+                buffer.data() + chunkPos * elementSize,
+                data + blockPos * elementSize,
+                rowBytes );
+            size_t d = ndims - 1;
+            for( ; d > 0; --d )
+            {
+                if( ++index[ d - 1 ] < count[ d - 1 ] )
+                    break;
+                index[ d - 1 ] = 0;
+            }
+            if( d == 0 )
+                break;
+        }
+
+        for( Stage const & stage : pipeline )
+        {
+            if( stage.id == H5Z_FILTER_SHUFFLE )
+            {
+                // byte j of each element goes to the j-th segment
+                if( elementSize < 2 )
+                    continue;
+                std::vector< char > shuffled( buffer.size() );
+                size_t const n = buffer.size() / elementSize;
+                for( size_t i = 0; i < n; ++i )
+                    for( size_t j = 0; j < elementSize; ++j )
+                        shuffled[ j * n + i ] = buffer[ i * elementSize + j ];
+                buffer = std::move( shuffled );
+            }
+#if openPMD_HAVE_ZLIB
+            else if( stage.id == H5Z_FILTER_DEFLATE )
+            {
+                // like HDF5's deflate filter: a zlib stream via compress2
+                uLongf size = compressBound( buffer.size() );
+                std::vector< char > compressed( size );
+                int const res = compress2(
+                    reinterpret_cast< Bytef * >( compressed.data() ),
+                    &size,
+                    reinterpret_cast< Bytef const * >( buffer.data() ),
+                    buffer.size(),
+                    static_cast< int >( stage.level ) );
+                if( res != Z_OK )
+                    throw std::runtime_error(
+                        "[HDF5] Failed to deflate a chunk during direct "
+                        "chunk write" );
+                compressed.resize( size );
+                buffer = std::move( compressed );
+            }
+#endif
+        }
+        return buffer;
+    };
+
+    /*
+     * HDF5 is not thread-safe, so chunks are filtered concurrently and
+     * written one after another, a few per thread at a time to bound the
+     * memory held by filtered chunks.
+     */
+    unsigned const threads = m_compressionThreads > 0
+        ? m_compressionThreads
+        : std::max( 1u, std::thread::hardware_concurrency() );
+    size_t const batchSize = 4 * static_cast< size_t >( threads );
+    std::vector< std::vector< char > > filtered;
+    std::vector< std::vector< hsize_t > > chunkOffsets;
+    for( size_t first = 0; first < numChunks; first += batchSize )
+    {
+        size_t const batch = std::min( batchSize, numChunks - first );
+        filtered.assign( batch, std::vector< char >() );
+        chunkOffsets.assign( batch, std::vector< hsize_t >( ndims ) );
+        auxiliary::parallelFor(
+            batch,
+            threads,
+            [ & ]( size_t i )
+            {
+                filtered[ i ] = filterChunk( first + i, chunkOffsets[ i ] );
+            } );
+        for( size_t i = 0; i < batch; ++i )
+        {
+            status = H5Dwrite_chunk(
+                dataset,
+                m_datasetTransferProperty,
+                0, /* all filters applied */
+                chunkOffsets[ i ].data(),
+                filtered[ i ].size(),
+                filtered[ i ].data() );
+            VERIFY(status == 0, "[HDF5] Internal error: Failed to write chunk during direct chunk write");
+        }
+    }
+    m_handler->m_statistics.count( "hdf5.direct_chunk_writes", numChunks );
+    return true;
+#else
+    (void)dataset;
+    (void)dataType;
+    (void)parameters;
+    return false;
+#endif
+}
+
 void
 HDF5IOHandlerImpl::writeAttribute(Writable* writable,
                                   Parameter< Operation::WRITE_ATT > const& parameters)
@@ -990,9 +1549,7 @@ HDF5IOHandlerImpl::writeAttribute(Writable* writable,
     auto res = getFile( writable );
         File file = res ? res.get() : getFile( writable->parent ).get();
     hid_t node_id, attribute_id;
-    node_id = H5Oopen(file.id,
-                      concrete_h5_file_position(writable).c_str(),
-                      H5P_DEFAULT);
+    node_id = obtainHandle(file.id, concrete_h5_file_position(writable));
     VERIFY(node_id >= 0, "[HDF5] Internal error: Failed to open HDF5 object during attribute write");
     Attribute const att(parameters.resource);
     Datatype dtype = parameters.dtype;
@@ -1247,8 +1804,6 @@ HDF5IOHandlerImpl::writeAttribute(Writable* writable,
 
     status = H5Aclose(attribute_id);
     VERIFY(status == 0, "[HDF5] Internal error: Failed to close attribute " + name + " at " + concrete_h5_file_position(writable) + " during attribute write");
-    status = H5Oclose(node_id);
-    VERIFY(status == 0, "[HDF5] Internal error: Failed to close " + concrete_h5_file_position(writable) + " during attribute write");
 
     m_fileNames[writable] = file.name;
 }
@@ -1261,9 +1816,7 @@ HDF5IOHandlerImpl::readDataset(Writable* writable,
         File file = res ? res.get() : getFile( writable->parent ).get();
     hid_t dataset_id, memspace, filespace;
     herr_t status;
-    dataset_id = H5Dopen(file.id,
-                         concrete_h5_file_position(writable).c_str(),
-                         H5P_DEFAULT);
+    dataset_id = obtainHandle(file.id, concrete_h5_file_position(writable));
     VERIFY(dataset_id >= 0, "[HDF5] Internal error: Failed to open HDF5 dataset during dataset read");
 
     std::vector< hsize_t > start;
@@ -1338,8 +1891,6 @@ HDF5IOHandlerImpl::readDataset(Writable* writable,
     VERIFY(status == 0, "[HDF5] Internal error: Failed to close dataset file space during dataset read");
     status = H5Sclose(memspace);
     VERIFY(status == 0, "[HDF5] Internal error: Failed to close dataset memory space during dataset read");
-    status = H5Dclose(dataset_id);
-    VERIFY(status == 0, "[HDF5] Internal error: Failed to close dataset during dataset read");
 }
 
 void
@@ -1354,9 +1905,7 @@ HDF5IOHandlerImpl::readAttribute(Writable* writable,
 
     hid_t obj_id, attr_id;
     herr_t status;
-    obj_id = H5Oopen(file.id,
-                     concrete_h5_file_position(writable).c_str(),
-                     H5P_DEFAULT);
+    obj_id = obtainHandle(file.id, concrete_h5_file_position(writable));
     VERIFY(obj_id >= 0, std::string("[HDF5] Internal error: Failed to open HDF5 object '") +
         concrete_h5_file_position(writable).c_str() + "' during attribute read");
     std::string const & attr_name = parameters.name;
@@ -1368,9 +1917,88 @@ HDF5IOHandlerImpl::readAttribute(Writable* writable,
         attr_name + "' (" +
         concrete_h5_file_position(writable).c_str() + ") during attribute read");
 
+    Attribute a = readAttributeValue(attr_id, attr_name, concrete_h5_file_position(writable));
+
+    auto dtype = parameters.dtype;
+    *dtype = a.dtype;
+    auto resource = parameters.resource;
+    *resource = a.getResource();
+
+    status = H5Aclose(attr_id);
+    VERIFY(status == 0, "[HDF5] Internal error: Failed to close attribute " + attr_name + " at " + concrete_h5_file_position(writable) + " during attribute read");
+}
+
+void
+HDF5IOHandlerImpl::readAttributes(Writable* writable,
+                                  Parameter< Operation::READ_ATTS >& parameters)
+{
+    if( !writable->written )
+        throw std::runtime_error("[HDF5] Internal error: Writable not marked written during attribute read");
+
+    auto res = getFile( writable );
+        File file = res ? res.get() : getFile( writable->parent ).get();
+
+    // resolve the object once instead of once per attribute
+    std::string const location = concrete_h5_file_position(writable);
+    hid_t obj_id = obtainHandle(file.id, location);
+    VERIFY(obj_id >= 0, "[HDF5] Internal error: Failed to open HDF5 object '" + location + "' during attribute read");
+
+    herr_t status;
+#if H5_VERSION_GE(1,12,0)
+    H5O_info2_t object_info;
+    status = H5Oget_info3(obj_id, &object_info, H5O_INFO_NUM_ATTRS);
+#else
+    H5O_info_t object_info;
+    status = H5Oget_info(obj_id, &object_info);
+#endif
+    VERIFY(status == 0, "[HDF5] Internal error: Failed to get HDF5 object info for " + location + " during attribute read");
+
+    for( hsize_t i = 0; i < object_info.num_attrs; ++i )
+    {
+        hid_t attr_id = H5Aopen_by_idx(obj_id,
+                                       ".",
+                                       H5_INDEX_CRT_ORDER,
+                                       H5_ITER_INC,
+                                       i,
+                                       H5P_DEFAULT,
+                                       H5P_DEFAULT);
+        VERIFY(attr_id >= 0, "[HDF5] Internal error: Failed to open HDF5 attribute (" + location + ") during attribute read");
+        ssize_t name_length = H5Aget_name(attr_id, 0, nullptr);
+        std::vector< char > name(name_length+1);
+        H5Aget_name(attr_id, name_length+1, name.data());
+        std::string attr_name(name.data(), name_length);
+
+        try
+        {
+            Attribute a = readAttributeValue(attr_id, attr_name, location);
+            (*parameters.attributes)[attr_name] =
+                std::make_pair(a.dtype, a.getResource());
+        }
+        catch( unsupported_data_error const & e )
+        {
+            (*parameters.skipped)[attr_name] = e.what();
+        }
+
+        status = H5Aclose(attr_id);
+        VERIFY(status == 0, "[HDF5] Internal error: Failed to close attribute " + attr_name + " at " + location + " during attribute read");
+    }
+}
+
+Attribute
+HDF5IOHandlerImpl::readAttributeValue(hid_t attr_id,
+                                      std::string const & attr_name,
+                                      std::string const & location)
+{
+    herr_t status;
     hid_t attr_type, attr_space;
     attr_type = H5Aget_type(attr_id);
     attr_space = H5Aget_space(attr_id);
+    // release type and space before reporting an unsupported attribute
+    auto unsupported = [&]( std::string const & what ) {
+        H5Tclose(attr_type);
+        H5Sclose(attr_space);
+        return unsupported_data_error(what);
+    };
 
     int ndims = H5Sget_simple_extent_ndims(attr_space);
     std::vector< hsize_t > dims(ndims, 0);
@@ -1486,7 +2114,7 @@ HDF5IOHandlerImpl::readAttribute(Writable* writable,
                                  c);
                 VERIFY(status == 0,
                     "[HDF5] Internal error: Failed to read attribute " + attr_name +
-                    " at " + concrete_h5_file_position(writable));
+                    " at " + location);
                 a = Attribute(auxiliary::strip(std::string(c), {'\0'}));
                 status = H5Dvlen_reclaim(attr_type,
                                          attr_space,
@@ -1523,7 +2151,7 @@ HDF5IOHandlerImpl::readAttribute(Writable* writable,
                                  &enumVal);
                 a = Attribute(static_cast< bool >(enumVal));
             } else
-                throw unsupported_data_error("[HDF5] Unsupported attribute enumeration");
+                throw unsupported("[HDF5] Unsupported attribute enumeration");
         } else if( H5Tget_class(attr_type) == H5T_COMPOUND )
         {
             bool isComplexType = false;
@@ -1586,10 +2214,10 @@ HDF5IOHandlerImpl::readAttribute(Writable* writable,
                     a = Attribute(cld);
                 }
                 else
-                    throw unsupported_data_error("[HDF5] Unknown complex type representation");
+                    throw unsupported("[HDF5] Unknown complex type representation");
             }
             else
-                throw unsupported_data_error("[HDF5] Compound attribute type not supported");
+                throw unsupported("[HDF5] Compound attribute type not supported");
         }
         else
             throw std::runtime_error("[HDF5] Unsupported scalar attribute type");
@@ -1731,7 +2359,7 @@ HDF5IOHandlerImpl::readAttribute(Writable* writable,
                                  vc.data());
                 VERIFY(status == 0,
                     "[HDF5] Internal error: Failed to read attribute " + attr_name +
-                    " at " + concrete_h5_file_position(writable));
+                    " at " + location);
                 for( auto const& val : vc )
                     vs.push_back(auxiliary::strip(std::string(val), {'\0'}));
                 status = H5Dvlen_reclaim(attr_type,
@@ -1753,22 +2381,14 @@ HDF5IOHandlerImpl::readAttribute(Writable* writable,
             throw std::runtime_error("[HDF5] Unsupported simple attribute type");
     } else
         throw std::runtime_error("[HDF5] Unsupported attribute class");
-    VERIFY(status == 0, "[HDF5] Internal error: Failed to read attribute " + attr_name + " at " + concrete_h5_file_position(writable));
+    VERIFY(status == 0, "[HDF5] Internal error: Failed to read attribute " + attr_name + " at " + location);
 
     status = H5Tclose(attr_type);
     VERIFY(status == 0, "[HDF5] Internal error: Failed to close attribute datatype during attribute read");
     status = H5Sclose(attr_space);
     VERIFY(status == 0, "[HDF5] Internal error: Failed to close attribute file space during attribute read");
 
-    auto dtype = parameters.dtype;
-    *dtype = a.dtype;
-    auto resource = parameters.resource;
-    *resource = a.getResource();
-
-    status = H5Aclose(attr_id);
-    VERIFY(status == 0, "[HDF5] Internal error: Failed to close attribute " + attr_name + " at " + concrete_h5_file_position(writable) + " during attribute read");
-    status = H5Oclose(obj_id);
-    VERIFY(status == 0, "[HDF5] Internal error: Failed to close " + concrete_h5_file_position(writable) + " during attribute read");
+    return a;
 }
 
 void
@@ -1780,9 +2400,7 @@ HDF5IOHandlerImpl::listPaths(Writable* writable,
 
     auto res = getFile( writable );
         File file = res ? res.get() : getFile( writable->parent ).get();
-    hid_t node_id = H5Gopen(file.id,
-                            concrete_h5_file_position(writable).c_str(),
-                            H5P_DEFAULT);
+    hid_t node_id = obtainHandle(file.id, concrete_h5_file_position(writable));
     VERIFY(node_id >= 0, "[HDF5] Internal error: Failed to open HDF5 group during path listing");
 
     H5G_info_t group_info;
@@ -1800,9 +2418,6 @@ HDF5IOHandlerImpl::listPaths(Writable* writable,
             paths->push_back(std::string(name.data(), name_length));
         }
     }
-
-    status = H5Gclose(node_id);
-    VERIFY(status == 0, "[HDF5] Internal error: Failed to close HDF5 group " + concrete_h5_file_position(writable) + " during path listing");
 }
 
 void
@@ -1814,9 +2429,7 @@ HDF5IOHandlerImpl::listDatasets(Writable* writable,
 
     auto res = getFile( writable );
         File file = res ? res.get() : getFile( writable->parent ).get();
-    hid_t node_id = H5Gopen(file.id,
-                            concrete_h5_file_position(writable).c_str(),
-                            H5P_DEFAULT);
+    hid_t node_id = obtainHandle(file.id, concrete_h5_file_position(writable));
     VERIFY(node_id >= 0, "[HDF5] Internal error: Failed to open HDF5 group during dataset listing");
 
     H5G_info_t group_info;
@@ -1834,9 +2447,6 @@ HDF5IOHandlerImpl::listDatasets(Writable* writable,
             datasets->push_back(std::string(name.data(), name_length));
         }
     }
-
-    status = H5Gclose(node_id);
-    VERIFY(status == 0, "[HDF5] Internal error: Failed to close HDF5 group " + concrete_h5_file_position(writable) + " during dataset listing");
 }
 
 void HDF5IOHandlerImpl::listAttributes(Writable* writable,
@@ -1848,9 +2458,7 @@ void HDF5IOHandlerImpl::listAttributes(Writable* writable,
     auto res = getFile( writable );
         File file = res ? res.get() : getFile( writable->parent ).get();
     hid_t node_id;
-    node_id = H5Oopen(file.id,
-                      concrete_h5_file_position(writable).c_str(),
-                      H5P_DEFAULT);
+    node_id = obtainHandle(file.id, concrete_h5_file_position(writable));
     VERIFY(node_id >= 0, "[HDF5] Internal error: Failed to open HDF5 group during attribute listing");
 
     herr_t status;
@@ -1885,9 +2493,110 @@ void HDF5IOHandlerImpl::listAttributes(Writable* writable,
                            H5P_DEFAULT);
         attributes->push_back(std::string(name.data(), name_length));
     }
+}
+
+std::future< void >
+HDF5IOHandlerImpl::flush()
+{
+    try
+    {
+        AbstractIOHandlerImpl::flush();
+    }
+    catch( ... )
+    {
+        flushHandles();
+        throw;
+    }
+    flushHandles();
+    return std::future< void >();
+}
 
-    status = H5Oclose(node_id);
-    VERIFY(status == 0, "[HDF5] Internal error: Failed to close HDF5 object during attribute listing");
+void
+HDF5IOHandlerImpl::setFilePosition(
+    Writable * writable, std::shared_ptr< HDF5FilePosition > position )
+{
+    // objects below may have cached a path through the previous position
+    if( writable->abstractFilePosition )
+        ++HDF5FilePosition::generation;
+    writable->abstractFilePosition = std::move( position );
+}
+
+hid_t
+HDF5IOHandlerImpl::obtainHandle( hid_t file, std::string const & path )
+{
+    HandleKey key{ file, path };
+    auto it = m_handles.find( key );
+    if( it != m_handles.end() )
+    {
+        m_handleLRU.splice(
+            m_handleLRU.begin(), m_handleLRU, it->second.lruPosition );
+        return it->second.id;
+    }
+
+    hid_t id = H5Oopen( file, path.c_str(), H5P_DEFAULT );
+    if( id < 0 )
+        return id;
+    m_handler->m_statistics.count( "hdf5.handle_opens" );
+
+    // keep at least the handle returned from this call
+    while( !m_handleLRU.empty() &&
+           m_handleLRU.size() >= std::max< size_t >( m_handleCacheSize, 1u ) )
+    {
+        auto evicted = m_handles.find( m_handleLRU.back() );
+        herr_t status = H5Oclose( evicted->second.id );
+        m_handles.erase( evicted );
+        m_handleLRU.pop_back();
+        VERIFY(status == 0, "[HDF5] Internal error: Failed to close cached HDF5 object handle");
+    }
+    m_handleLRU.push_front( key );
+    m_handles.emplace(
+        std::move( key ), CachedHandle{ id, m_handleLRU.begin() } );
+    return id;
+}
+
+void
+HDF5IOHandlerImpl::flushHandles()
+{
+    bool const readOnly = m_handler->m_backendAccess == Access::READ_ONLY;
+    for( auto it = m_handles.begin(); it != m_handles.end(); )
+    {
+        if( m_handleCacheSize > 0 )
+        {
+            if( readOnly || H5Iget_type( it->second.id ) != H5I_DATASET )
+            {
+                ++it;
+                continue;
+            }
+#if H5_VERSION_GE(1,10,0)
+            // write out the chunk cache, but keep the dataset open
+            herr_t status = H5Dflush( it->second.id );
+            VERIFY(status == 0, "[HDF5] Internal error: Failed to flush cached HDF5 dataset handle");
+            ++it;
+            continue;
+#endif
+        }
+        herr_t status = H5Oclose( it->second.id );
+        m_handleLRU.erase( it->second.lruPosition );
+        it = m_handles.erase( it );
+        VERIFY(status == 0, "[HDF5] Internal error: Failed to close cached HDF5 object handle");
+    }
+}
+
+void
+HDF5IOHandlerImpl::closeHandles( hid_t file )
+{
+    for( auto it = m_handles.begin(); it != m_handles.end(); )
+    {
+        if( file >= 0 && it->first.first != file )
+        {
+            ++it;
+            continue;
+        }
+        if( H5Oclose( it->second.id ) < 0 )
+            std::cerr << "[HDF5] Internal error: Failed to close cached HDF5 object handle\n";
+        m_handleLRU.erase( it->second.lruPosition );
+        it = m_handles.erase( it );
+    }
 }
 
 auxiliary::Option< HDF5IOHandlerImpl::File >
@@ -1924,6 +2633,21 @@ HDF5IOHandler::flush()
 {
     return m_impl->flush();
 }
+
+bool
+HDF5IOHandler::supportsBackgroundFlush() const
+{
+    /*
+     * Other Series (and the HDF5 calls of this one that are not deferred)
+     * keep using the library from the calling thread.
+     */
+#if H5_VERSION_GE(1,8,16)
+    hbool_t threadsafe = false;
+    return H5is_library_threadsafe( &threadsafe ) >= 0 && threadsafe;
+#else
+    return false;
+#endif
+}
 #else
 HDF5IOHandler::HDF5IOHandler(std::string path, Access at, nlohmann::json /* config */)
         : AbstractIOHandler(std::move(path), at)
@@ -1938,5 +2662,11 @@ HDF5IOHandler::flush()
 {
     return std::future< void >();
 }
+
+bool
+HDF5IOHandler::supportsBackgroundFlush() const
+{
+    return false;
+}
 #endif
 } // openPMD
@@ -84,10 +84,26 @@ ParallelHDF5IOHandlerImpl::ParallelHDF5IOHandlerImpl(
     VERIFY(status >= 0, "[HDF5] Internal error: Failed to set HDF5 dataset transfer property");
     status = H5Pset_fapl_mpio(m_fileAccessProperty, m_mpiComm, m_mpiInfo);
     VERIFY(status >= 0, "[HDF5] Internal error: Failed to set HDF5 file access property");
+
+    if( m_directChunkWrite )
+    {
+        std::cerr << "Warning: HDF5 direct chunk writes are not supported "
+                     "with MPI-IO and are disabled." << std::endl;
+        m_directChunkWrite = false;
+    }
+
+    /*
+     * Evicting from the handle cache depends on the tasks of this rank,
+     * so closing a handle would not happen collectively.
+     * Keep only the handle in use, and close it at the end of the flush.
+     */
+    m_handleCacheSize = 0;
 }
 
 ParallelHDF5IOHandlerImpl::~ParallelHDF5IOHandlerImpl()
 {
+    // files opened with the MPI-IO driver cannot be closed with open objects
+    closeHandles( -1 );
     herr_t status;
     while( !m_openFileIDs.empty() )
     {
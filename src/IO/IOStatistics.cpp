@@ -0,0 +1,48 @@
+/* Copyright 2021 The openPMD Community
+ *
+ * This file is part of openPMD-api.
+ *
+ * openPMD-api is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openPMD-api is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with openPMD-api.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "openPMD/IO/IOStatistics.hpp"
+
+#include <nlohmann/json.hpp>
+
+
+namespace openPMD
+{
+std::string
+IOStatistics::toJSON( int indent ) const
+{
+    nlohmann::json res = nlohmann::json::object();
+    for( size_t i = 0; i < numOperations; ++i )
+    {
+        auto const & stats = m_operations[ i ];
+        if( stats.count == 0 )
+            continue;
+        nlohmann::json & entry =
+            res[ operationToString( static_cast< Operation >( i ) ) ];
+        entry[ "count" ] = stats.count;
+        entry[ "seconds" ] =
+            std::chrono::duration< double >( stats.time ).count();
+        entry[ "bytes" ] = stats.bytes;
+    }
+    if( !m_counters.empty() )
+        res[ "counters" ] = m_counters;
+    return res.dump( indent );
+}
+} // namespace openPMD
@@ -21,10 +21,130 @@
 #include "openPMD/IO/IOTask.hpp"
 #include "openPMD/backend/Attributable.hpp"
 
+#include <mutex>
+#include <new>
+
 
 namespace openPMD
 {
 Writable*
 getWritable(AttributableImpl* a)
 { return &a->writable(); }
+
+std::string
+operationToString( Operation op )
+{
+    switch( op )
+    {
+        using O = Operation;
+        case O::CREATE_FILE: return "CREATE_FILE";
+        case O::OPEN_FILE: return "OPEN_FILE";
+        case O::CLOSE_FILE: return "CLOSE_FILE";
+        case O::DELETE_FILE: return "DELETE_FILE";
+        case O::CREATE_PATH: return "CREATE_PATH";
+        case O::CLOSE_PATH: return "CLOSE_PATH";
+        case O::OPEN_PATH: return "OPEN_PATH";
+        case O::DELETE_PATH: return "DELETE_PATH";
+        case O::LIST_PATHS: return "LIST_PATHS";
+        case O::CREATE_DATASET: return "CREATE_DATASET";
+        case O::EXTEND_DATASET: return "EXTEND_DATASET";
+        case O::OPEN_DATASET: return "OPEN_DATASET";
+        case O::DELETE_DATASET: return "DELETE_DATASET";
+        case O::WRITE_DATASET: return "WRITE_DATASET";
+        case O::READ_DATASET: return "READ_DATASET";
+        case O::LIST_DATASETS: return "LIST_DATASETS";
+        case O::GET_BUFFER_VIEW: return "GET_BUFFER_VIEW";
+        case O::DELETE_ATT: return "DELETE_ATT";
+        case O::WRITE_ATT: return "WRITE_ATT";
+        case O::READ_ATT: return "READ_ATT";
+        case O::LIST_ATTS: return "LIST_ATTS";
+        case O::READ_ATTS: return "READ_ATTS";
+        case O::ADVANCE: return "ADVANCE";
+        case O::AVAILABLE_CHUNKS: return "AVAILABLE_CHUNKS";
+        case O::PREFETCH_FILES: return "PREFETCH_FILES";
+    }
+    return "UNKNOWN";
+}
+
+namespace internal
+{
+namespace
+{
+    /** Thread-safe stack of equally sized memory blocks.
+     *
+     * Bounded in length so that an exceptionally large flush does not keep
+     * its memory occupied for the rest of the run.
+     */
+    class FreeList
+    {
+    public:
+        void * pop()
+        {
+            std::lock_guard< std::mutex > lock( m_mutex );
+            if( !m_head )
+                return nullptr;
+            Node * node = m_head;
+            m_head = node->next;
+            --m_length;
+            return node;
+        }
+
+        bool push( void * ptr )
+        {
+            std::lock_guard< std::mutex > lock( m_mutex );
+            if( m_length >= maxLength )
+                return false;
+            m_head = new( ptr ) Node{ m_head };
+            ++m_length;
+            return true;
+        }
+
+    private:
+        struct Node
+        {
+            Node * next;
+        };
+
+        static constexpr std::size_t maxLength = 1u << 14;
+
+        std::mutex m_mutex;
+        Node * m_head = nullptr;
+        std::size_t m_length = 0;
+    };
+
+    // size classes of 64, 128, ..., 512 bytes
+    constexpr std::size_t granularity = 64;
+    constexpr std::size_t numSizeClasses = 8;
+
+    std::size_t sizeClass( std::size_t bytes )
+    {
+        return bytes == 0 ? 0 : ( bytes - 1 ) / granularity;
+    }
+
+    FreeList * freeLists()
+    {
+        // intentionally never destroyed, tasks may still be released during
+        // static destruction
+        static FreeList * lists = new FreeList[ numSizeClasses ];
+        return lists;
+    }
+} // namespace [anonymous]
+
+void * allocateParameterMemory( std::size_t bytes )
+{
+    std::size_t const sc = sizeClass( bytes );
+    if( sc >= numSizeClasses )
+        return ::operator new( bytes );
+    if( void * ptr = freeLists()[ sc ].pop() )
+        return ptr;
+    return ::operator new( ( sc + 1 ) * granularity );
+}
+
+void deallocateParameterMemory( void * ptr, std::size_t bytes ) noexcept
+{
+    std::size_t const sc = sizeClass( bytes );
+    if( sc >= numSizeClasses || !freeLists()[ sc ].push( ptr ) )
+        ::operator delete( ptr );
+}
+} // namespace internal
 } // openPMD
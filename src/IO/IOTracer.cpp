@@ -0,0 +1,264 @@
+/* Copyright 2021 The openPMD Community
+ *
+ * This file is part of openPMD-api.
+ *
+ * openPMD-api is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openPMD-api is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with openPMD-api.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "openPMD/IO/IOTracer.hpp"
+#include "openPMD/IO/IOTask.hpp"
+#include "openPMD/backend/Writable.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+
+namespace openPMD
+{
+namespace
+{
+    template< typename Vec >
+    std::string vectorToString( Vec const & vec )
+    {
+        std::ostringstream res;
+        res << '[';
+        for( size_t i = 0; i < vec.size(); ++i )
+        {
+            if( i > 0 )
+                res << ", ";
+            res << vec[ i ];
+        }
+        res << ']';
+        return res.str();
+    }
+
+    template< typename T >
+    std::string toString( T const & value )
+    {
+        std::ostringstream res;
+        res << value;
+        return res.str();
+    }
+
+    template< Operation op >
+    void datasetArgs(
+        IOTask const & task,
+        std::vector< std::pair< std::string, std::string > > & args )
+    {
+        auto const & param =
+            *static_cast< Parameter< op > const * >( task.parameter.get() );
+        args.emplace_back( "dtype", toString( param.dtype ) );
+        args.emplace_back( "offset", vectorToString( param.offset ) );
+        args.emplace_back( "extent", vectorToString( param.extent ) );
+    }
+} // namespace [anonymous]
+
+IOTracer::IOTracer( std::string file, int rank )
+    : m_file{ std::move( file ) }
+    , m_rank{ rank }
+{
+    using namespace std::chrono;
+    auto const system = duration_cast< duration< double, std::micro > >(
+        system_clock::now().time_since_epoch() );
+    auto const steady = duration_cast< duration< double, std::micro > >(
+        Clock::now().time_since_epoch() );
+    m_epochOffset = system.count() - steady.count();
+}
+
+IOTracer::~IOTracer()
+{
+    try
+    {
+        write();
+    }
+    catch( std::exception const & ex )
+    {
+        std::cerr << "[IOTracer] Could not write trace file '" << m_file
+                  << "': " << ex.what() << std::endl;
+    }
+}
+
+void
+IOTracer::recordTask(
+    IOTask const & task, Clock::time_point begin, Clock::time_point end )
+{
+    Event event;
+    event.name = operationToString( task.operation );
+    event.category = "backend";
+
+    std::string path;
+    std::vector< std::string > keys;
+    for( Writable const * w = task.writable; w && w->parent; w = w->parent )
+    {
+        for( auto it = w->ownKeyWithinParent.rbegin();
+             it != w->ownKeyWithinParent.rend();
+             ++it )
+        {
+            keys.push_back( *it );
+        }
+    }
+    for( auto it = keys.rbegin(); it != keys.rend(); ++it )
+        path += "/" + *it;
+    event.args.emplace_back( "path", path.empty() ? "/" : path );
+
+    switch( task.operation )
+    {
+        case Operation::WRITE_DATASET:
+            datasetArgs< Operation::WRITE_DATASET >( task, event.args );
+            break;
+        case Operation::READ_DATASET:
+            datasetArgs< Operation::READ_DATASET >( task, event.args );
+            break;
+        case Operation::CREATE_DATASET:
+        {
+            auto const & param =
+                *static_cast< Parameter< Operation::CREATE_DATASET > const * >(
+                    task.parameter.get() );
+            event.args.emplace_back( "name", param.name );
+            event.args.emplace_back( "dtype", toString( param.dtype ) );
+            event.args.emplace_back( "extent", vectorToString( param.extent ) );
+            break;
+        }
+        case Operation::WRITE_ATT:
+        {
+            auto const & param =
+                *static_cast< Parameter< Operation::WRITE_ATT > const * >(
+                    task.parameter.get() );
+            event.args.emplace_back( "name", param.name );
+            event.args.emplace_back( "dtype", toString( param.dtype ) );
+            break;
+        }
+        case Operation::READ_ATT:
+        {
+            auto const & param =
+                *static_cast< Parameter< Operation::READ_ATT > const * >(
+                    task.parameter.get() );
+            event.args.emplace_back( "name", param.name );
+            break;
+        }
+        default:
+            break;
+    }
+
+    event.begin = microseconds( begin );
+    event.duration = microseconds( end ) - event.begin;
+    record( std::move( event ) );
+}
+
+void
+IOTracer::recordSpan(
+    std::string name,
+    std::string category,
+    Clock::time_point begin,
+    Clock::time_point end )
+{
+    Event event;
+    event.name = std::move( name );
+    event.category = std::move( category );
+    event.begin = microseconds( begin );
+    event.duration = microseconds( end ) - event.begin;
+    record( std::move( event ) );
+}
+
+void
+IOTracer::record( Event event )
+{
+    std::lock_guard< std::mutex > lock( m_mutex );
+    event.thread = threadIndex();
+    m_events.push_back( std::move( event ) );
+}
+
+double
+IOTracer::microseconds( Clock::time_point tp ) const
+{
+    using namespace std::chrono;
+    return duration_cast< duration< double, std::micro > >(
+               tp.time_since_epoch() )
+               .count() +
+        m_epochOffset;
+}
+
+unsigned
+IOTracer::threadIndex()
+{
+    auto const id = std::this_thread::get_id();
+    auto it = m_threads.find( id );
+    if( it == m_threads.end() )
+    {
+        unsigned const index = static_cast< unsigned >( m_threads.size() );
+        it = m_threads.emplace( id, index ).first;
+    }
+    return it->second;
+}
+
+void
+IOTracer::write() const
+{
+    nlohmann::json events = nlohmann::json::array();
+    {
+        std::lock_guard< std::mutex > lock( m_mutex );
+        for( auto const & event : m_events )
+        {
+            nlohmann::json entry{
+                { "name", event.name },
+                { "cat", event.category },
+                { "ph", "X" },
+                { "ts", event.begin },
+                { "dur", event.duration },
+                { "pid", m_rank },
+                { "tid", event.thread } };
+            if( !event.args.empty() )
+            {
+                nlohmann::json & args = entry[ "args" ];
+                for( auto const & arg : event.args )
+                    args[ arg.first ] = arg.second;
+            }
+            events.push_back( std::move( entry ) );
+        }
+    }
+    nlohmann::json trace{
+        { "traceEvents", std::move( events ) }, { "displayTimeUnit", "ms" } };
+
+    std::ofstream out( m_file );
+    if( !out )
+        throw std::runtime_error( "Cannot open file for writing." );
+    out << trace.dump() << std::endl;
+}
+
+IOTracer::Scope::Scope(
+    std::shared_ptr< IOTracer > tracer,
+    char const * name,
+    char const * category )
+    : m_tracer{ std::move( tracer ) }
+    , m_name{ name }
+    , m_category{ category }
+{
+    if( m_tracer )
+        m_begin = Clock::now();
+}
+
+IOTracer::Scope::~Scope()
+{
+    if( m_tracer )
+    {
+        m_tracer->recordSpan( m_name, m_category, m_begin, Clock::now() );
+    }
+}
+} // namespace openPMD
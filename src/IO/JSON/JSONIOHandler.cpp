@@ -28,13 +28,15 @@ namespace openPMD
 
     JSONIOHandler::JSONIOHandler(
         std::string path,
-        Access at
+        Access at,
+        nlohmann::json config,
+        std::string encoding
     ) :
         AbstractIOHandler {
             path,
             at
         },
-        m_impl { JSONIOHandlerImpl { this } }
+        m_impl { this, std::move( config ), std::move( encoding ) }
     {}
 
     std::future< void > JSONIOHandler::flush( )
@@ -19,17 +19,43 @@
  * If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include "openPMD/auxiliary/Environment.hpp"
 #include "openPMD/auxiliary/Filesystem.hpp"
+#include "openPMD/auxiliary/JSON.hpp"
 #include "openPMD/auxiliary/Memory.hpp"
 #include "openPMD/auxiliary/Option.hpp"
+#include "openPMD/auxiliary/ParallelFor.hpp"
 #include "openPMD/auxiliary/StringManip.hpp"
 #include "openPMD/backend/Writable.hpp"
 #include "openPMD/Datatype.hpp"
 #include "openPMD/DatatypeHelpers.hpp"
 #include "openPMD/IO/JSON/JSONIOHandlerImpl.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <deque>
 #include <exception>
+#include <future>
+#include <iomanip>
 #include <iostream>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <set>
+#include <streambuf>
+#include <thread>
+#include <tuple>
+
+#ifndef _WIN32
+#   include <fcntl.h>
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   include <unistd.h>
+#endif
 
 
 namespace openPMD
@@ -43,9 +69,962 @@ namespace openPMD
 #define VERIFY_ALWAYS( CONDITION, TEXT ) { if(!(CONDITION)) throw std::runtime_error((TEXT)); }
 
 
-    JSONIOHandlerImpl::JSONIOHandlerImpl( AbstractIOHandler * handler ) :
-        AbstractIOHandlerImpl( handler )
-    {}
+    /*
+     * Worker threads read and parse the announced files in order. At most
+     * two files per thread are held ahead of the reader, so memory stays
+     * bounded for long lists of files.
+     */
+    class JSONIOHandlerImpl::Prefetcher
+    {
+    public:
+        Prefetcher(
+            std::vector< std::string > paths,
+            unsigned threads,
+            FileEncoding encoding,
+            bool deferDatasets,
+            bool mmap )
+            : m_queue( paths.begin(), paths.end() )
+            , m_maxAhead{ 2 * static_cast< size_t >( threads ) }
+            , m_encoding{ encoding }
+            , m_deferDatasets{ deferDatasets }
+            , m_mmap{ mmap }
+        {
+            for( unsigned i = 0; i < threads; ++i )
+            {
+                m_threads.emplace_back( [ this ]() { work(); } );
+            }
+        }
+
+        ~Prefetcher()
+        {
+            {
+                std::lock_guard< std::mutex > lock( m_mutex );
+                m_stop = true;
+            }
+            m_cv.notify_all();
+            for( auto & thread : m_threads )
+            {
+                thread.join();
+            }
+        }
+
+        /*
+         * The parsed contents of the file at path, or a nullptr if it has
+         * not been prefetched (successfully), so the caller reads it itself.
+         */
+        std::shared_ptr< nlohmann::json > take( std::string const & path )
+        {
+            std::shared_future< std::shared_ptr< nlohmann::json > > future;
+            {
+                std::lock_guard< std::mutex > lock( m_mutex );
+                auto it = m_started.find( path );
+                if( it == m_started.end() )
+                {
+                    auto queued =
+                        std::find( m_queue.begin(), m_queue.end(), path );
+                    if( queued != m_queue.end() )
+                    {
+                        m_queue.erase( queued );
+                    }
+                    return nullptr;
+                }
+                future = std::move( it->second );
+                m_started.erase( it );
+            }
+            m_cv.notify_all();
+            try
+            {
+                return future.get();
+            }
+            catch( ... )
+            {
+                // let the caller report the error
+                return nullptr;
+            }
+        }
+
+    private:
+        void work()
+        {
+            while( true )
+            {
+                std::string path;
+                std::promise< std::shared_ptr< nlohmann::json > > promise;
+                {
+                    std::unique_lock< std::mutex > lock( m_mutex );
+                    m_cv.wait( lock, [ this ]() {
+                        return m_stop || m_queue.empty() ||
+                            m_started.size() < m_maxAhead;
+                    } );
+                    if( m_stop || m_queue.empty() )
+                    {
+                        return;
+                    }
+                    path = std::move( m_queue.front() );
+                    m_queue.pop_front();
+                    m_started.emplace( path, promise.get_future().share() );
+                }
+                try
+                {
+                    auto res = std::make_shared< nlohmann::json >();
+                    if( !m_mmap ||
+                        !parseMappedFile(
+                            path, *res, m_encoding, m_deferDatasets ) )
+                    {
+                        std::ifstream file( path, std::ios_base::binary );
+                        VERIFY_ALWAYS( file.good(),
+                            "[JSON] Failed opening a file" );
+                        parseJson( file, *res, m_encoding, m_deferDatasets );
+                    }
+                    promise.set_value( std::move( res ) );
+                }
+                catch( ... )
+                {
+                    promise.set_exception( std::current_exception() );
+                }
+            }
+        }
+
+        std::mutex m_mutex;
+        std::condition_variable m_cv;
+        std::deque< std::string > m_queue;
+        std::map<
+            std::string,
+            std::shared_future< std::shared_ptr< nlohmann::json > > >
+            m_started;
+        size_t m_maxAhead;
+        FileEncoding m_encoding;
+        bool m_deferDatasets;
+        bool m_mmap;
+        bool m_stop = false;
+        std::vector< std::thread > m_threads;
+    };
+
+
+    namespace
+    {
+        size_t fileSize( std::string const & path )
+        {
+            std::ifstream file( path, std::ios_base::binary | std::ios_base::ate );
+            auto const size = file.tellg( );
+            return size > 0 ? static_cast< size_t >( size ) : 0;
+        }
+
+        size_t numElements( Extent const & extent )
+        {
+            size_t res = 1;
+            for( auto ext : extent )
+            {
+                res *= ext;
+            }
+            return res;
+        }
+
+        /*
+         * Call f( datasetIndex, bufferIndex, length ) for each contiguous
+         * row (along the last dimension) of the hyperslab (offset, extent)
+         * within a row-major dataset of extent datasetExtent.
+         * datasetIndex is the row's position within the dataset,
+         * bufferIndex its position within a contiguous buffer holding only
+         * the hyperslab.
+         */
+        template< typename F >
+        void forEachRow(
+            Extent const & datasetExtent,
+            Offset const & offset,
+            Extent const & extent,
+            F && f )
+        {
+            size_t const dims = extent.size( );
+            if( dims == 0 )
+            {
+                f( 0, 0, 1 );
+                return;
+            }
+            if( numElements( extent ) == 0 )
+            {
+                return;
+            }
+            Extent stride( dims );
+            stride[ dims - 1 ] = 1;
+            for( size_t d = dims - 1; d > 0; --d )
+            {
+                stride[ d - 1 ] = stride[ d ] * datasetExtent[ d ];
+            }
+            size_t const rowLength = extent[ dims - 1 ];
+            // position within the hyperslab, last dimension excluded
+            Extent index( dims - 1, 0 );
+            size_t bufferIndex = 0;
+            while( true )
+            {
+                size_t datasetIndex = offset[ dims - 1 ];
+                for( size_t d = 0; d + 1 < dims; ++d )
+                {
+                    datasetIndex += ( offset[ d ] + index[ d ] ) * stride[ d ];
+                }
+                f( datasetIndex, bufferIndex, rowLength );
+                bufferIndex += rowLength;
+                // advance to the next row
+                size_t d = dims - 1;
+                for( ; d > 0; --d )
+                {
+                    if( ++index[ d - 1 ] < extent[ d - 1 ] )
+                    {
+                        break;
+                    }
+                    index[ d - 1 ] = 0;
+                }
+                if( d == 0 )
+                {
+                    return;
+                }
+            }
+        }
+
+        /*
+         * Base64 encoding of raw buffers, in groups of three bytes to four
+         * characters. A buffer of n bytes is encoded into
+         * base64Length( n ) characters, the last group padded with '='.
+         * Single groups can be decoded and re-encoded in place, so that
+         * hyperslabs of a dataset are read and written without touching
+         * the rest of the string.
+         */
+        char const * const base64Chars =
+            "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+        size_t base64Length( size_t bytes )
+        {
+            return ( bytes + 2 ) / 3 * 4;
+        }
+
+        unsigned char base64Value( char c )
+        {
+            if( c >= 'A' && c <= 'Z' )
+            {
+                return static_cast< unsigned char >( c - 'A' );
+            }
+            if( c >= 'a' && c <= 'z' )
+            {
+                return static_cast< unsigned char >( c - 'a' + 26 );
+            }
+            if( c >= '0' && c <= '9' )
+            {
+                return static_cast< unsigned char >( c - '0' + 52 );
+            }
+            switch( c )
+            {
+                case '+':
+                    return 62;
+                case '/':
+                    return 63;
+                case '=':
+                    return 0;
+                default:
+                    throw std::runtime_error(
+                        "[JSON] Invalid character in base64 data." );
+            }
+        }
+
+        /*
+         * Decode the groups [firstGroup, endGroup) of the base64 string
+         * into out, which must hold 3 * ( endGroup - firstGroup ) bytes.
+         */
+        void decodeBase64Groups(
+            std::string const & base64,
+            size_t firstGroup,
+            size_t endGroup,
+            unsigned char * out )
+        {
+            for( size_t group = firstGroup; group < endGroup; ++group )
+            {
+                char const * in = &base64[ 4 * group ];
+                unsigned const bits = base64Value( in[ 0 ] ) << 18u |
+                    base64Value( in[ 1 ] ) << 12u |
+                    base64Value( in[ 2 ] ) << 6u | base64Value( in[ 3 ] );
+                *out++ = static_cast< unsigned char >( bits >> 16u );
+                *out++ = static_cast< unsigned char >( bits >> 8u );
+                *out++ = static_cast< unsigned char >( bits );
+            }
+        }
+
+        /*
+         * Inverse of decodeBase64Groups, for a buffer of totalBytes bytes
+         * in total (so the last group is padded correctly).
+         */
+        void encodeBase64Groups(
+            unsigned char const * in,
+            size_t firstGroup,
+            size_t endGroup,
+            size_t totalBytes,
+            std::string & base64 )
+        {
+            for( size_t group = firstGroup; group < endGroup; ++group, in += 3 )
+            {
+                size_t const valid = std::min< size_t >( 3, totalBytes - 3 * group );
+                unsigned const bits = in[ 0 ] << 16u |
+                    ( valid > 1 ? in[ 1 ] : 0 ) << 8u | ( valid > 2 ? in[ 2 ] : 0 );
+                char * out = &base64[ 4 * group ];
+                out[ 0 ] = base64Chars[ ( bits >> 18u ) & 63u ];
+                out[ 1 ] = base64Chars[ ( bits >> 12u ) & 63u ];
+                out[ 2 ] = valid > 1 ? base64Chars[ ( bits >> 6u ) & 63u ] : '=';
+                out[ 3 ] = valid > 2 ? base64Chars[ bits & 63u ] : '=';
+            }
+        }
+
+        std::string encodeBase64( unsigned char const * in, size_t bytes )
+        {
+            std::string res( base64Length( bytes ), '=' );
+            encodeBase64Groups( in, 0, res.size( ) / 4, bytes, res );
+            return res;
+        }
+
+        void readBase64Bytes(
+            std::string const & base64,
+            size_t byteOffset,
+            size_t bytes,
+            char * out )
+        {
+            if( bytes == 0 )
+            {
+                return;
+            }
+            size_t const firstGroup = byteOffset / 3;
+            size_t const endGroup = ( byteOffset + bytes + 2 ) / 3;
+            std::vector< unsigned char > groups( 3 * ( endGroup - firstGroup ) );
+            decodeBase64Groups( base64, firstGroup, endGroup, groups.data( ) );
+            std::memcpy( out, groups.data( ) + byteOffset % 3, bytes );
+        }
+
+        void writeBase64Bytes(
+            std::string & base64,
+            size_t totalBytes,
+            size_t byteOffset,
+            size_t bytes,
+            char const * in )
+        {
+            if( bytes == 0 )
+            {
+                return;
+            }
+            size_t const firstGroup = byteOffset / 3;
+            size_t const endGroup = ( byteOffset + bytes + 2 ) / 3;
+            std::vector< unsigned char > groups( 3 * ( endGroup - firstGroup ) );
+            // bytes of the first and last group that are not overwritten
+            // need to be preserved
+            decodeBase64Groups( base64, firstGroup, firstGroup + 1, groups.data( ) );
+            decodeBase64Groups(
+                base64, endGroup - 1, endGroup, &groups[ groups.size( ) - 3 ] );
+            std::memcpy( groups.data( ) + byteOffset % 3, in, bytes );
+            encodeBase64Groups(
+                groups.data( ), firstGroup, endGroup, totalBytes, base64 );
+        }
+
+        bool littleEndian( )
+        {
+            uint16_t const one = 1;
+            unsigned char first;
+            std::memcpy( &first, &one, 1 );
+            return first == 1;
+        }
+
+        /*
+         * Key under which the position of a deferred "data" array within
+         * its file is recorded in the dataset object.
+         * Only exists in memory, files with deferred datasets are never
+         * written back.
+         */
+        char const * const deferredDataKey = "deferred_data";
+
+        /*
+         * Read position within a memory buffer or a stream, shared by all
+         * copies of a CursorIterator. Allows the SAX handler below to move
+         * the parser's input past a dataset.
+         */
+        class Cursor
+        {
+        public:
+            Cursor( char const * begin, char const * end )
+                : m_begin{ begin }
+                , m_pos{ begin }
+                , m_end{ end }
+            {
+            }
+
+            // read from the current position of a stream buffer on,
+            // without copying the stream into memory
+            explicit Cursor( std::streambuf * buf )
+                : m_buf{ buf }
+                , m_start{ buf->pubseekoff( 0, std::ios_base::cur, std::ios_base::in ) }
+            {
+            }
+
+            bool atEnd( ) const
+            {
+                return m_buf
+                    ? m_buf->sgetc( ) == std::streambuf::traits_type::eof( )
+                    : m_pos == m_end;
+            }
+
+            char get( ) const
+            {
+                return m_buf
+                    ? std::streambuf::traits_type::to_char_type( m_buf->sgetc( ) )
+                    : *m_pos;
+            }
+
+            void advance( )
+            {
+                if( m_buf )
+                {
+                    m_buf->sbumpc( );
+                }
+                else
+                {
+                    ++m_pos;
+                }
+                ++m_offset;
+            }
+
+            // number of characters read since the start
+            size_t offset( ) const
+            {
+                return m_offset;
+            }
+
+            // go back to a previous offset
+            void seek( size_t offset )
+            {
+                if( m_buf )
+                {
+                    VERIFY_ALWAYS( m_start != std::streampos( -1 ) &&
+                        m_buf->pubseekpos(
+                            m_start + std::streamoff( offset ),
+                            std::ios_base::in ) != std::streampos( -1 ),
+                        "[JSON] Cannot seek within the file being parsed." )
+                }
+                else
+                {
+                    m_pos = m_begin + offset;
+                }
+                m_offset = offset;
+            }
+
+        private:
+            char const * m_begin = nullptr;
+            char const * m_pos = nullptr;
+            char const * m_end = nullptr;
+            std::streambuf * m_buf = nullptr;
+            std::streampos m_start = 0;
+            size_t m_offset = 0;
+        };
+
+        class CursorIterator
+        {
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using value_type = char;
+            using difference_type = std::ptrdiff_t;
+            using pointer = char const *;
+            using reference = char;
+
+            /*
+             * Result of the postfix increment: since all copies of a
+             * CursorIterator share their position, the old position is
+             * kept as the character found there, as in
+             * std::istreambuf_iterator.
+             */
+            class Proxy
+            {
+            public:
+                explicit Proxy( char c ) : m_char{ c }
+                {
+                }
+
+                char operator*( ) const
+                {
+                    return m_char;
+                }
+
+            private:
+                char m_char;
+            };
+
+            explicit CursorIterator( Cursor * cursor = nullptr )
+                : m_cursor{ cursor }
+            {
+            }
+
+            reference operator*( ) const
+            {
+                return m_cursor->get( );
+            }
+
+            CursorIterator & operator++( )
+            {
+                m_cursor->advance( );
+                return *this;
+            }
+
+            Proxy operator++( int )
+            {
+                Proxy old{ m_cursor->get( ) };
+                m_cursor->advance( );
+                return old;
+            }
+
+            bool operator==( CursorIterator const & other ) const
+            {
+                return atEnd( ) == other.atEnd( );
+            }
+
+            bool operator!=( CursorIterator const & other ) const
+            {
+                return !( *this == other );
+            }
+
+        private:
+            Cursor * m_cursor;
+
+            bool atEnd( ) const
+            {
+                return !m_cursor || m_cursor->atEnd( );
+            }
+        };
+
+        /*
+         * Given the cursor right behind the opening bracket of a JSON array,
+         * move it to the closing bracket.
+         * Scans the raw characters without parsing any values.
+         * Stores the extent of the nested arrays in shape, i.e. the shape
+         * that getExtent() would report.
+         * Returns false if the arrays are not rectangular, i.e. if arrays on
+         * the same nesting level differ in length or mix arrays and
+         * scalars, or if the closing bracket is missing. The cursor is left
+         * at an unspecified position then.
+         */
+        bool skipArray( Cursor & cursor, Extent & shape )
+        {
+            enum class Kind
+            {
+                Unknown,
+                Scalar,
+                Array
+            };
+            constexpr size_t unknownLength =
+                std::numeric_limits< size_t >::max( );
+            // per nesting level: number of elements in the array that is
+            // currently open, length of the first array closed on this
+            // level and kind of the elements
+            std::vector< size_t > count{ 0 };
+            std::vector< size_t > length{ unknownLength };
+            std::vector< Kind > kind{ Kind::Unknown };
+            size_t depth = 0;
+            bool expectValue = true;
+            auto addElement = [ & ]( Kind k ) {
+                ++count[ depth ];
+                expectValue = false;
+                if( kind[ depth ] == Kind::Unknown )
+                {
+                    kind[ depth ] = k;
+                }
+                return kind[ depth ] == k;
+            };
+            for( ; !cursor.atEnd( ); cursor.advance( ) )
+            {
+                switch( cursor.get( ) )
+                {
+                    case ' ':
+                    case '\t':
+                    case '\n':
+                    case '\r':
+                        break;
+                    case ',':
+                        expectValue = true;
+                        break;
+                    case ']':
+                        if( length[ depth ] == unknownLength )
+                        {
+                            length[ depth ] = count[ depth ];
+                        }
+                        else if( length[ depth ] != count[ depth ] )
+                        {
+                            return false;
+                        }
+                        if( depth == 0 )
+                        {
+                            for( size_t level = 0; level < length.size( );
+                                 ++level )
+                            {
+                                shape.push_back( length[ level ] );
+                                if( kind[ level ] != Kind::Array )
+                                {
+                                    break;
+                                }
+                            }
+                            return true;
+                        }
+                        --depth;
+                        expectValue = false;
+                        break;
+                    case '[':
+                        if( !addElement( Kind::Array ) )
+                        {
+                            return false;
+                        }
+                        ++depth;
+                        if( depth == count.size( ) )
+                        {
+                            count.push_back( 0 );
+                            length.push_back( unknownLength );
+                            kind.push_back( Kind::Unknown );
+                        }
+                        count[ depth ] = 0;
+                        expectValue = true;
+                        break;
+                    case '"':
+                        if( !addElement( Kind::Scalar ) )
+                        {
+                            return false;
+                        }
+                        for( cursor.advance( );
+                             !cursor.atEnd( ) && cursor.get( ) != '"';
+                             cursor.advance( ) )
+                        {
+                            if( cursor.get( ) == '\\' )
+                            {
+                                cursor.advance( );
+                                if( cursor.atEnd( ) )
+                                {
+                                    return false;
+                                }
+                            }
+                        }
+                        if( cursor.atEnd( ) )
+                        {
+                            return false;
+                        }
+                        break;
+                    default:
+                        if( expectValue && !addElement( Kind::Scalar ) )
+                        {
+                            return false;
+                        }
+                        break;
+                }
+            }
+            return false;
+        }
+
+        /*
+         * SAX handler building the JSON tree, except for the contents of
+         * arrays under the key "data", i.e. of datasets.
+         * Those are skipped without parsing, the dataset instead records
+         * where its data is found in the file.
+         * Datasets that are not rectangular are parsed along with the rest.
+         */
+        class DeferringSax
+        {
+        public:
+            using number_integer_t = nlohmann::json::number_integer_t;
+            using number_unsigned_t = nlohmann::json::number_unsigned_t;
+            using number_float_t = nlohmann::json::number_float_t;
+            using string_t = nlohmann::json::string_t;
+            using binary_t = nlohmann::json::binary_t;
+
+            DeferringSax( nlohmann::json & root, Cursor & cursor )
+                : m_root( root )
+                , m_cursor( cursor )
+            {
+            }
+
+            bool null( )
+            {
+                handleValue( nullptr );
+                return true;
+            }
+
+            bool boolean( bool val )
+            {
+                handleValue( val );
+                return true;
+            }
+
+            bool number_integer( number_integer_t val )
+            {
+                handleValue( val );
+                return true;
+            }
+
+            bool number_unsigned( number_unsigned_t val )
+            {
+                handleValue( val );
+                return true;
+            }
+
+            bool number_float( number_float_t val, string_t const & )
+            {
+                handleValue( val );
+                return true;
+            }
+
+            bool string( string_t & val )
+            {
+                handleValue( val );
+                return true;
+            }
+
+            bool binary( binary_t & val )
+            {
+                handleValue( std::move( val ) );
+                return true;
+            }
+
+            bool start_object( std::size_t )
+            {
+                m_stack.push_back( handleValue( nlohmann::json::object( ) ) );
+                return true;
+            }
+
+            bool key( string_t & val )
+            {
+                m_objectElement = &( *m_stack.back( ) )[ val ];
+                m_dataKey = val == "data";
+                return true;
+            }
+
+            bool end_object( )
+            {
+                m_stack.pop_back( );
+                return true;
+            }
+
+            bool start_array( std::size_t )
+            {
+                bool const deferred = m_dataKey && !m_stack.empty( ) &&
+                    m_stack.back( )->is_object( );
+                nlohmann::json * parent =
+                    m_stack.empty( ) ? nullptr : m_stack.back( );
+                m_stack.push_back( handleValue( nlohmann::json::array( ) ) );
+                if( deferred )
+                {
+                    // the parser has just consumed the opening bracket
+                    size_t const begin = m_cursor.offset( );
+                    Extent shape;
+                    if( skipArray( m_cursor, shape ) )
+                    {
+                        nlohmann::json & record =
+                            ( *parent )[ deferredDataKey ];
+                        record[ "begin" ] = begin - 1;
+                        record[ "end" ] = m_cursor.offset( ) + 1;
+                        record[ "shape" ] = shape;
+                        // the parser continues with the closing bracket
+                    }
+                    else
+                    {
+                        // parse ragged (or broken) data eagerly, so the
+                        // parser reports errors as usual
+                        m_cursor.seek( begin );
+                    }
+                }
+                return true;
+            }
+
+            bool end_array( )
+            {
+                m_stack.pop_back( );
+                return true;
+            }
+
+            // rethrow with the concrete type (parse_error, out_of_range, ...)
+            template< typename Exception >
+            bool parse_error(
+                std::size_t,
+                std::string const &,
+                Exception const & ex )
+            {
+                throw ex;
+            }
+
+        private:
+            nlohmann::json & m_root;
+            Cursor & m_cursor;
+            std::vector< nlohmann::json * > m_stack;
+            nlohmann::json * m_objectElement = nullptr;
+            bool m_dataKey = false;
+
+            template< typename Value >
+            nlohmann::json * handleValue( Value && v )
+            {
+                m_dataKey = false;
+                if( m_stack.empty( ) )
+                {
+                    m_root = nlohmann::json( std::forward< Value >( v ) );
+                    return &m_root;
+                }
+                if( m_stack.back( )->is_array( ) )
+                {
+                    m_stack.back( )->emplace_back( std::forward< Value >( v ) );
+                    return &m_stack.back( )->back( );
+                }
+                *m_objectElement = nlohmann::json( std::forward< Value >( v ) );
+                return m_objectElement;
+            }
+        };
+
+        void parseDeferringDatasets( Cursor & cursor, nlohmann::json & j )
+        {
+            DeferringSax sax( j, cursor );
+            nlohmann::json::sax_parse(
+                CursorIterator( &cursor ),
+                CursorIterator( ),
+                &sax );
+        }
+
+        /*
+         * Read-only memory mapping of a whole file.
+         * Not valid if the file cannot be mapped, e.g. on Windows, for
+         * empty files or on filesystems without mmap support.
+         */
+        class MappedFile
+        {
+        public:
+            explicit MappedFile( std::string const & path )
+            {
+#ifndef _WIN32
+                int const fd = ::open( path.c_str( ), O_RDONLY );
+                if( fd < 0 )
+                {
+                    return;
+                }
+                struct stat status;
+                if( ::fstat( fd, &status ) == 0 && status.st_size > 0 )
+                {
+                    auto const size = static_cast< size_t >( status.st_size );
+                    void * data =
+                        ::mmap( nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0 );
+                    if( data != MAP_FAILED )
+                    {
+                        // the parsers read front to back
+                        ::madvise( data, size, MADV_SEQUENTIAL );
+                        m_data = data;
+                        m_size = size;
+                    }
+                }
+                ::close( fd );
+#else
+                (void)path;
+#endif
+            }
+
+            ~MappedFile( )
+            {
+#ifndef _WIN32
+                if( m_data )
+                {
+                    ::munmap( m_data, m_size );
+                }
+#endif
+            }
+
+            MappedFile( MappedFile const & ) = delete;
+            MappedFile & operator=( MappedFile const & ) = delete;
+
+            bool valid( ) const
+            {
+                return m_data != nullptr;
+            }
+
+            char const * begin( ) const
+            {
+                return static_cast< char const * >( m_data );
+            }
+
+            char const * end( ) const
+            {
+                return begin( ) + m_size;
+            }
+
+        private:
+            void * m_data = nullptr;
+            size_t m_size = 0;
+        };
+    } // namespace
+
+
+    JSONIOHandlerImpl::JSONIOHandlerImpl(
+        AbstractIOHandler * handler,
+        nlohmann::json config,
+        std::string encoding
+    ) :
+        AbstractIOHandlerImpl( handler ),
+        m_encoding{ encodingFromString( encoding ) },
+        m_suffix{ "." + encoding }
+    {
+        auto envCacheSize =
+            auxiliary::getEnvString( "OPENPMD_JSON_CACHE_SIZE", "" );
+        if( !envCacheSize.empty( ) )
+        {
+            m_cacheSize = std::stoull( envCacheSize );
+        }
+        // JSON option can overwrite env option:
+        if( config.contains( "json" ) )
+        {
+            auxiliary::TracingJSON jsonConfig( std::move( config[ "json" ] ) );
+            if( jsonConfig.json( ).contains( "cache_size" ) )
+            {
+                m_cacheSize =
+                    jsonConfig[ "cache_size" ].json( ).get< size_t >( );
+            }
+            if( jsonConfig.json( ).contains( "encoding" ) )
+            {
+                // files carry the ending of their effective encoding
+                encoding =
+                    jsonConfig[ "encoding" ].json( ).get< std::string >( );
+                m_encoding = encodingFromString( encoding );
+                m_suffix = "." + encoding;
+            }
+            if( jsonConfig.json( ).contains( "flush_threads" ) )
+            {
+                m_flushThreads =
+                    jsonConfig[ "flush_threads" ].json( ).get< unsigned >( );
+            }
+            if( jsonConfig.json( ).contains( "mmap" ) )
+            {
+                m_mmap = jsonConfig[ "mmap" ].json( ).get< bool >( );
+            }
+            if( jsonConfig.json( ).contains( "format" ) )
+            {
+                m_pretty = formatFromString(
+                    jsonConfig[ "format" ].json( ).get< std::string >( ) );
+            }
+            if( jsonConfig.json( ).contains( "defer_dataset_parsing" ) )
+            {
+                m_deferDatasets =
+                    jsonConfig[ "defer_dataset_parsing" ].json( ).get< bool >( );
+            }
+            if( jsonConfig.json( ).contains( "dataset" ) )
+            {
+                auto datasetConfig = jsonConfig[ "dataset" ];
+                if( datasetConfig.json( ).contains( "layout" ) )
+                {
+                    m_datasetLayout = datasetLayoutFromString(
+                        datasetConfig[ "layout" ].json( ).get< std::string >( ) );
+                }
+            }
+
+            // unused params
+            auto shadow = jsonConfig.invertShadow( );
+            if( shadow.size( ) > 0 )
+            {
+                std::cerr << "Warning: parts of the JSON configuration for "
+                             "JSON remain unused:\n"
+                          << shadow << std::endl;
+            }
+        }
+        // deferred datasets cannot be written back
+        m_deferDatasets = m_deferDatasets &&
+            m_handler->m_backendAccess == Access::READ_ONLY;
+    }
 
 
     JSONIOHandlerImpl::~JSONIOHandlerImpl( )
@@ -69,14 +1048,39 @@ namespace openPMD
     std::future< void > JSONIOHandlerImpl::flush( )
     {
         AbstractIOHandlerImpl::flush( );
+        // the modified files are independent of one another
+        std::vector< std::pair< File, CachedFile * > > files;
+        files.reserve( m_dirty.size( ) );
         for( auto const & file: m_dirty )
         {
-            putJsonContents(
-                file,
-                false
-            );
+            auto it = m_jsonVals.find( file );
+            if( it != m_jsonVals.end( ) )
+            {
+                files.emplace_back( file, &it->second );
+            }
+        }
+        std::vector< size_t > bytes( files.size( ) );
+        auxiliary::parallelFor(
+            files.size( ),
+            m_flushThreads,
+            [ this, &files, &bytes ]( size_t i )
+            {
+                bytes[ i ] = writeJsonFile(
+                    files[ i ].first,
+                    *files[ i ].second->contents
+                );
+            }
+        );
+        for( size_t i = 0; i < files.size( ); ++i )
+        {
+            m_cachedBytes -= files[ i ].second->bytes;
+            files[ i ].second->bytes = bytes[ i ];
+            m_cachedBytes += bytes[ i ];
         }
         m_dirty.clear( );
+        // keep the file in use, even if it alone exceeds the cache size,
+        // otherwise it is re-parsed after every flush
+        evictFiles( m_lru.empty( ) ? File( ) : m_lru.front( ) );
         return std::future< void >( );
     }
 
@@ -94,10 +1098,10 @@ namespace openPMD
             std::string name = parameters.name;
             if( !auxiliary::ends_with(
                 name,
-                ".json"
+                m_suffix
             ) )
             {
-                name += ".json";
+                name += m_suffix;
             }
 
             auto res_pair = getPossiblyExisting( name );
@@ -111,7 +1115,7 @@ namespace openPMD
             {
                 auto file = std::get< 0 >( res_pair );
                 m_dirty.erase( file );
-                m_jsonVals.erase( file );
+                uncacheFile( file );
                 file.invalidate( );
             }
 
@@ -130,8 +1134,11 @@ namespace openPMD
             this->m_dirty
                 .emplace( shared_name );
             // make sure to overwrite!
-            this->m_jsonVals[shared_name] =
-                std::make_shared< nlohmann::json >( );
+            cacheFile(
+                shared_name,
+                std::make_shared< nlohmann::json >( ),
+                0
+            );
 
 
             writable->written = true;
@@ -165,6 +1172,7 @@ namespace openPMD
         auto file = refreshFileFromParent( writable );
 
         auto * jsonVal = &*obtainJsonContents( file );
+        bool created;
         if( !auxiliary::starts_with(
             path,
             "/"
@@ -176,7 +1184,7 @@ namespace openPMD
             );
 
             jsonVal = &( *jsonVal )[filepos->id];
-            ensurePath(
+            created = ensurePath(
                 jsonVal,
                 path
             );
@@ -187,13 +1195,18 @@ namespace openPMD
         else
         {
 
-            ensurePath(
+            created = ensurePath(
                 jsonVal,
                 path
             );
         }
 
-        m_dirty.emplace( file );
+        // re-creating existing paths (e.g. upon flushing a Series that
+        // has been opened for reading and writing) changes nothing
+        if( created )
+        {
+            m_dirty.emplace( file );
+        }
         writable->written = true;
         writable->abstractFilePosition =
             std::make_shared< JSONFilePosition >( nlohmann::json::json_pointer( path ) );
@@ -226,23 +1239,74 @@ namespace openPMD
                 writable,
                 name
             );
+            auto layout = m_datasetLayout;
+            auto config = nlohmann::json::parse( parameter.options );
+            if( config.contains( "json" ) &&
+                config[ "json" ].contains( "dataset" ) )
+            {
+                auxiliary::TracingJSON datasetConfig{
+                    config[ "json" ][ "dataset" ] };
+                if( datasetConfig.json( ).contains( "layout" ) )
+                {
+                    layout = datasetLayoutFromString(
+                        datasetConfig[ "layout" ].json( ).get< std::string >( ) );
+                }
+
+                auto shadow = datasetConfig.invertShadow( );
+                if( shadow.size( ) > 0 )
+                {
+                    std::cerr << "Warning: parts of the JSON configuration for "
+                                 "JSON dataset '"
+                              << name << "' remain unused:\n"
+                              << shadow << std::endl;
+                }
+            }
+
             auto & dset = jsonVal[name];
             dset["datatype"] = datatypeToString( parameter.dtype );
-            switch( parameter.dtype )
+            if( layout == DatasetLayout::Base64 )
             {
-                case Datatype::CFLOAT:
-                case Datatype::CDOUBLE:
-                case Datatype::CLONG_DOUBLE:
+                VERIFY_ALWAYS( littleEndian( ),
+                    "[JSON] The base64 dataset layout is only supported on "
+                    "little-endian platforms." );
+                size_t const bytes =
+                    numElements( parameter.extent ) * toBytes( parameter.dtype );
+                // base64 of zero bytes, "=" padding the last group
+                std::string data( base64Length( bytes ), 'A' );
+                for( size_t i = bytes % 3 == 0 ? 0 : 3 - bytes % 3; i > 0; --i )
                 {
-                    auto complexExtent = parameter.extent;
-                    complexExtent.push_back( 2 );
-                    dset["data"] = initializeNDArray( complexExtent );
-                    break;
+                    data[ data.size( ) - i ] = '=';
+                }
+                dset["extent"] = parameter.extent;
+                dset["data"] = std::move( data );
+            }
+            else if( layout == DatasetLayout::Flat )
+            {
+                // complex numbers are stored as [re, im] in each element
+                dset["extent"] = parameter.extent;
+                dset["data"] =
+                    nlohmann::json::array_t( numElements( parameter.extent ) );
+            }
+            else
+            {
+                switch( parameter.dtype )
+                {
+                    case Datatype::CFLOAT:
+                    case Datatype::CDOUBLE:
+                    case Datatype::CLONG_DOUBLE:
+                    {
+                        auto complexExtent = parameter.extent;
+                        complexExtent.push_back( 2 );
+                        dset["data"] = initializeNDArray( complexExtent );
+                        break;
+                    }
+                    default:
+                        dset["data"] = initializeNDArray( parameter.extent );
+                        break;
                 }
-                default:
-                    dset["data"] = initializeNDArray( parameter.extent );
-                    break;
             }
+            // written chunks, appended to by writeDataset
+            dset["chunks"] = nlohmann::json::array( );
             writable->written = true;
             m_dirty.emplace( file );
         }
@@ -282,7 +1346,7 @@ namespace openPMD
             m_handler->m_backendAccess != Access::READ_ONLY,
             "[JSON] Cannot extend a dataset in read-only mode." )
         setAndGetFilePosition( writable );
-        refreshFileFromParent( writable );
+        auto file = refreshFileFromParent( writable );
         auto & j = obtainJsonContents( writable );
 
         try
@@ -307,6 +1371,62 @@ namespace openPMD
             throw std::runtime_error(
                 "[JSON] The specified location contains no valid dataset" );
         }
+        if( isBase64Dataset( j ) )
+        {
+            auto const oldExtent = getExtent( j );
+            size_t const elementSize = toBytes(
+                stringToDatatype( j[ "datatype" ].get< std::string >( ) ) );
+            std::string const & oldData =
+                j[ "data" ].get_ref< std::string const & >( );
+            std::vector< unsigned char > oldBuffer( 3 * ( oldData.size( ) / 4 ) );
+            decodeBase64Groups(
+                oldData, 0, oldData.size( ) / 4, oldBuffer.data( ) );
+            std::vector< unsigned char > newBuffer(
+                numElements( parameters.extent ) * elementSize );
+            forEachRow(
+                parameters.extent,
+                Offset( oldExtent.size( ), 0 ),
+                oldExtent,
+                [ &newBuffer, &oldBuffer, elementSize ](
+                    size_t datasetIndex, size_t bufferIndex, size_t length )
+                {
+                    std::memcpy(
+                        &newBuffer[ datasetIndex * elementSize ],
+                        &oldBuffer[ bufferIndex * elementSize ],
+                        length * elementSize );
+                } );
+            j[ "data" ] = encodeBase64( newBuffer.data( ), newBuffer.size( ) );
+            j[ "extent" ] = parameters.extent;
+            writable->written = true;
+            m_dirty.emplace( file );
+            return;
+        }
+        if( j.contains( "extent" ) )
+        {
+            // flat layout, move the old rows to their new positions
+            auto const oldExtent = getExtent( j );
+            nlohmann::json newData =
+                nlohmann::json::array_t( numElements( parameters.extent ) );
+            nlohmann::json & oldData = j[ "data" ];
+            forEachRow(
+                parameters.extent,
+                Offset( oldExtent.size( ), 0 ),
+                oldExtent,
+                [ &newData, &oldData ](
+                    size_t datasetIndex, size_t bufferIndex, size_t length )
+                {
+                    for( size_t i = 0; i < length; ++i )
+                    {
+                        newData[ datasetIndex + i ] =
+                            std::move( oldData[ bufferIndex + i ] );
+                    }
+                } );
+            j[ "data" ] = std::move( newData );
+            j[ "extent" ] = parameters.extent;
+            writable->written = true;
+            m_dirty.emplace( file );
+            return;
+        }
         switch( stringToDatatype( j[ "datatype" ].get< std::string >() ) )
         {
             case Datatype::CFLOAT:
@@ -330,6 +1450,7 @@ namespace openPMD
                 break;
         }
         writable->written = true;
+        m_dirty.emplace( file );
     }
 
     namespace
@@ -432,6 +1553,80 @@ namespace openPMD
             return res;
         }
 
+        /*
+         * Same as chunksInJSON, for a dataset in flat layout.
+         * Considers the (dim)-dimensional slab beginning at position base
+         * of the flat data array.
+         */
+        ChunkTable
+        chunksInFlatJSON(
+            nlohmann::json const & data,
+            Extent const & extent,
+            Extent const & stride,
+            size_t dim,
+            size_t base );
+        ChunkTable
+        chunksInFlatJSON(
+            nlohmann::json const & data,
+            Extent const & extent,
+            Extent const & stride,
+            size_t dim,
+            size_t base )
+        {
+            bool const leaf = dim + 1 == extent.size();
+            auto isNull = [ & ]( size_t i ) {
+                return leaf && data[ base + i ].is_null();
+            };
+            auto tableAt = [ & ]( size_t i ) {
+                return leaf
+                    ? ChunkTable{ WrittenChunkInfo( Offset{}, Extent{} ) }
+                    : chunksInFlatJSON(
+                          data, extent, stride, dim + 1, base + i * stride[ dim ] );
+            };
+            ChunkTable res;
+            size_t it = 0;
+            size_t end = extent[ dim ];
+            while( it < end )
+            {
+                // skip empty slots
+                while( it < end && isNull( it ) )
+                {
+                    ++it;
+                }
+                if( it == end )
+                {
+                    break;
+                }
+                size_t const offset = it;
+                ChunkTable referenceTable = tableAt( it );
+                ++it;
+                for( ; it < end; ++it )
+                {
+                    if( isNull( it ) || tableAt( it ) != referenceTable )
+                    {
+                        break;
+                    }
+                }
+                size_t const chunkExtent = it - offset;
+                for( auto const & chunk : referenceTable )
+                {
+                    Offset o = { offset };
+                    Extent e = { chunkExtent };
+                    for( auto entry : chunk.offset )
+                    {
+                        o.push_back( entry );
+                    }
+                    for( auto entry : chunk.extent )
+                    {
+                        e.push_back( entry );
+                    }
+                    res.emplace_back(
+                        std::move( o ), std::move( e ), chunk.sourceID );
+                }
+            }
+            return res;
+        }
+
         /*
          * Check whether two chunks can be merged to form a large one
          * and optionally return that larger chunk
@@ -537,6 +1732,30 @@ namespace openPMD
                 stillChanging = innerLoops();
             } while( stillChanging );
         }
+
+        /*
+         * Read the chunks recorded by writeDataset, skipping chunks that
+         * have been written repeatedly.
+         */
+        ChunkTable
+        chunksInTable( nlohmann::json const & chunks )
+        {
+            ChunkTable res;
+            std::set< std::tuple< Offset, Extent, unsigned > > seen;
+            for( auto const & chunk : chunks )
+            {
+                WrittenChunkInfo info(
+                    chunk[ "offset" ].get< Offset >( ),
+                    chunk[ "extent" ].get< Extent >( ),
+                    chunk[ "source" ].get< int >( ) );
+                if( seen.emplace( info.offset, info.extent, info.sourceID )
+                        .second )
+                {
+                    res.push_back( std::move( info ) );
+                }
+            }
+            return res;
+        }
     } // namespace
 
     void
@@ -546,8 +1765,45 @@ namespace openPMD
     {
         refreshFileFromParent( writable );
         auto filePosition = setAndGetFilePosition( writable );
-        auto & j = obtainJsonContents( writable )[ "data" ];
-        *parameters.chunks = chunksInJSON( j );
+        auto & j = obtainJsonContents( writable );
+        auto chunks = j.find( "chunks" );
+        if( chunks != j.end( ) )
+        {
+            *parameters.chunks = chunksInTable( *chunks );
+            return;
+        }
+        loadDeferredData( writable, j );
+        if( isBase64Dataset( j ) )
+        {
+            // without a chunk table, report the whole dataset
+            auto extent = getExtent( j );
+            Offset offset( extent.size( ), 0 );
+            *parameters.chunks = ChunkTable{
+                WrittenChunkInfo( std::move( offset ), std::move( extent ) ) };
+        }
+        else if( j.contains( "extent" ) )
+        {
+            auto const extent = getExtent( j );
+            if( extent.empty( ) )
+            {
+                *parameters.chunks = ChunkTable{
+                    WrittenChunkInfo( Offset{}, Extent{} ) };
+            }
+            else
+            {
+                Extent stride( extent.size( ), 1 );
+                for( size_t d = extent.size( ) - 1; d > 0; --d )
+                {
+                    stride[ d - 1 ] = stride[ d ] * extent[ d ];
+                }
+                *parameters.chunks =
+                    chunksInFlatJSON( j[ "data" ], extent, stride, 0, 0 );
+            }
+        }
+        else
+        {
+            *parameters.chunks = chunksInJSON( j[ "data" ] );
+        }
         mergeChunks( *parameters.chunks );
     }
 
@@ -566,10 +1822,10 @@ namespace openPMD
         std::string name = parameter.name;
         if( !auxiliary::ends_with(
             name,
-            ".json"
+            m_suffix
         ) )
         {
-            name += ".json";
+            name += m_suffix;
         }
 
         auto file = std::get< 0 >( getPossiblyExisting( name ) );
@@ -585,6 +1841,38 @@ namespace openPMD
     }
 
 
+    void JSONIOHandlerImpl::prefetchFiles(
+        Writable *,
+        Parameter< Operation::PREFETCH_FILES > const & parameters
+    )
+    {
+        if( parameters.threads < 2 || parameters.names.empty() )
+        {
+            return;
+        }
+        std::vector< std::string > paths;
+        paths.reserve( parameters.names.size() );
+        for( auto name : parameters.names )
+        {
+            if( !auxiliary::ends_with( name, m_suffix ) )
+            {
+                name += m_suffix;
+            }
+            paths.push_back( fullPath( name ) );
+        }
+        auto const threads = std::min(
+            static_cast< size_t >( parameters.threads ), paths.size() );
+        // replacing an earlier prefetcher joins its threads first
+        m_prefetcher.reset();
+        m_prefetcher = std::unique_ptr< Prefetcher >( new Prefetcher(
+            std::move( paths ),
+            static_cast< unsigned >( threads ),
+            m_encoding,
+            m_deferDatasets,
+            m_mmap ) );
+    }
+
+
     void JSONIOHandlerImpl::closeFile(
         Writable * writable,
         Parameter< Operation::CLOSE_FILE > const &
@@ -593,7 +1881,11 @@ namespace openPMD
         auto fileIterator = m_files.find( writable );
         if ( fileIterator != m_files.end( ) )
         {
-            putJsonContents( fileIterator->second );
+            // files that have only been read are not written back
+            if( m_dirty.find( fileIterator->second ) != m_dirty.end( ) )
+            {
+                putJsonContents( fileIterator->second );
+            }
             // do not invalidate the file
             // it still exists, it is just not open
             m_files.erase( fileIterator );
@@ -679,8 +1971,8 @@ namespace openPMD
 
         auto filename = auxiliary::ends_with(
             parameters.name,
-            ".json"
-        ) ? parameters.name : parameters.name + ".json";
+            m_suffix
+        ) ? parameters.name : parameters.name + m_suffix;
 
         auto tuple = getPossiblyExisting( filename );
         if( !std::get< 2 >( tuple ) )
@@ -688,7 +1980,7 @@ namespace openPMD
             // file is already in the system
             auto file = std::get< 0 >( tuple );
             m_dirty.erase( file );
-            m_jsonVals.erase( file );
+            uncacheFile( file );
             file.invalidate( );
         }
 
@@ -797,7 +2089,7 @@ namespace openPMD
             );
         }
 
-        putJsonContents( file );
+        m_dirty.emplace( file );
         writable->abstractFilePosition
             .reset( );
         writable->written = false;
@@ -852,7 +2144,7 @@ namespace openPMD
             parent = &obtainJsonContents( writable );
         }
         parent->erase( dataset );
-        putJsonContents( file );
+        m_dirty.emplace( file );
         writable->written = false;
         writable->abstractFilePosition
             .reset( );
@@ -873,8 +2165,12 @@ namespace openPMD
         setAndGetFilePosition( writable );
         auto file = refreshFileFromParent( writable );
         auto & j = obtainJsonContents( writable );
-        j.erase( parameters.name );
-        putJsonContents( file );
+        auto attributes = j.find( "attributes" );
+        if( attributes != j.end( ) )
+        {
+            attributes->erase( removeSlashes( parameters.name ) );
+        }
+        m_dirty.emplace( file );
     }
 
 
@@ -904,8 +2200,19 @@ namespace openPMD
             parameters
         );
 
+        // datasets from files without a chunk table are scanned instead,
+        // do not start one that would miss previously written chunks
+        auto chunks = j.find( "chunks" );
+        if( chunks != j.end( ) )
+        {
+            chunks->push_back( {
+                { "offset", parameters.offset },
+                { "extent", parameters.extent },
+                { "source", 0 } } );
+        }
+
         writable->written = true;
-        putJsonContents( file );
+        m_dirty.emplace( file );
     }
 
 
@@ -965,6 +2272,28 @@ namespace openPMD
             parameters,
             j
         );
+        loadDeferredData( writable, j );
+        if( isBase64Dataset( j ) )
+        {
+            // raw buffers are only meaningful with the writer's byte widths
+            // look up without inserting, the file may be written back
+            nlohmann::json const & root =
+                *obtainJsonContents( refreshFileFromParent( writable ) );
+            auto const datatype = j[ "datatype" ].get< std::string >( );
+            bool compatible = littleEndian( );
+            auto widths = root.find( "platform_byte_widths" );
+            if( widths != root.end( ) )
+            {
+                auto width = widths->find( datatype );
+                compatible = compatible &&
+                    ( width == widths->end( ) ||
+                      width->get< size_t >( ) ==
+                          toBytes( stringToDatatype( datatype ) ) );
+            }
+            VERIFY_ALWAYS( compatible,
+                "[JSON] Dataset in base64 layout was written on an "
+                "incompatible platform." );
+        }
 
         try
         {
@@ -972,7 +2301,7 @@ namespace openPMD
             switchType(
                 parameters.dtype,
                 dr,
-                j["data"],
+                j,
                 parameters
             );
         } catch( json::basic_json::type_error & )
@@ -1021,6 +2350,47 @@ namespace openPMD
     }
 
 
+    void JSONIOHandlerImpl::readAttributes(
+        Writable * writable,
+        Parameter< Operation::READ_ATTS > & parameters
+    )
+    {
+        VERIFY_ALWAYS( writable->written,
+            "[JSON] Attributes have to be written before reading." )
+        refreshFileFromParent( writable );
+        setAndGetFilePosition( writable );
+        auto & j = obtainJsonContents( writable );
+        auto attributes = j.find( "attributes" );
+        if( attributes == j.end( ) )
+        {
+            return;
+        }
+        // walk the attributes of the node once instead of once per attribute
+        Parameter< Operation::READ_ATT > aRead;
+        for( auto it = attributes->begin( ); it != attributes->end( ); it++ )
+        {
+            try
+            {
+                auto & entry = it.value( );
+                *aRead.dtype = Datatype(
+                    stringToDatatype( entry["datatype"].get< std::string >( ) ) );
+                AttributeReader ar;
+                switchType(
+                    *aRead.dtype,
+                    ar,
+                    entry["value"],
+                    aRead
+                );
+            } catch( json::type_error & )
+            {
+                throw std::runtime_error( "[JSON] The given location does not contain a properly formatted attribute" );
+            }
+            ( *parameters.attributes )[ it.key( ) ] =
+                std::make_pair( *aRead.dtype, *aRead.resource );
+        }
+    }
+
+
     void JSONIOHandlerImpl::listPaths(
         Writable * writable,
         Parameter< Operation::LIST_PATHS > & parameters
@@ -1095,19 +2465,22 @@ namespace openPMD
             "[JSON] Tried opening a file that has been overwritten or deleted." )
         auto path = fullPath( std::move( fileName ) );
         auto fs = std::make_shared< std::fstream >( );
+        auto const mode = m_encoding == FileEncoding::Text
+            ? std::ios_base::openmode( )
+            : std::ios_base::binary;
         switch( access )
         {
             case Access::CREATE:
             case Access::READ_WRITE:
                 fs->open(
                     path,
-                    std::ios_base::out | std::ios_base::trunc
+                    std::ios_base::out | std::ios_base::trunc | mode
                 );
                 break;
             case Access::READ_ONLY:
                 fs->open(
                     path,
-                    std::ios_base::in
+                    std::ios_base::in | mode
                 );
                 break;
         }
@@ -1117,6 +2490,206 @@ namespace openPMD
     }
 
 
+    JSONIOHandlerImpl::FileEncoding
+    JSONIOHandlerImpl::encodingFromString( std::string const & encoding )
+    {
+        if( encoding == "json" )
+        {
+            return FileEncoding::Text;
+        }
+        else if( encoding == "cbor" )
+        {
+            return FileEncoding::CBOR;
+        }
+        else if( encoding == "msgpack" )
+        {
+            return FileEncoding::MessagePack;
+        }
+        else if( encoding == "ubjson" )
+        {
+            return FileEncoding::UBJSON;
+        }
+        else if( encoding == "bson" )
+        {
+            return FileEncoding::BSON;
+        }
+        throw std::runtime_error(
+            "[JSON] Unknown encoding '" + encoding +
+            "', expected one of json, cbor, msgpack, ubjson, bson." );
+    }
+
+
+    bool JSONIOHandlerImpl::formatFromString( std::string const & format )
+    {
+        if( format == "compact" )
+        {
+            return false;
+        }
+        else if( format == "pretty" )
+        {
+            return true;
+        }
+        throw std::runtime_error(
+            "[JSON] Unknown output format '" + format +
+            "', expected one of compact, pretty." );
+    }
+
+
+    JSONIOHandlerImpl::DatasetLayout
+    JSONIOHandlerImpl::datasetLayoutFromString( std::string const & layout )
+    {
+        if( layout == "nested" )
+        {
+            return DatasetLayout::Nested;
+        }
+        else if( layout == "flat" )
+        {
+            return DatasetLayout::Flat;
+        }
+        else if( layout == "base64" )
+        {
+            return DatasetLayout::Base64;
+        }
+        throw std::runtime_error(
+            "[JSON] Unknown dataset layout '" + layout +
+            "', expected one of nested, flat, base64." );
+    }
+
+
+    void JSONIOHandlerImpl::parseJson(
+        std::istream & in,
+        nlohmann::json & j,
+        FileEncoding encoding,
+        bool deferDatasets
+    )
+    {
+        switch( encoding )
+        {
+            case FileEncoding::Text:
+                if( deferDatasets )
+                {
+                    Cursor cursor( in.rdbuf( ) );
+                    parseDeferringDatasets( cursor, j );
+                }
+                else
+                {
+                    in >> j;
+                }
+                break;
+            case FileEncoding::CBOR:
+                j = nlohmann::json::from_cbor( in );
+                break;
+            case FileEncoding::MessagePack:
+                j = nlohmann::json::from_msgpack( in );
+                break;
+            case FileEncoding::UBJSON:
+                j = nlohmann::json::from_ubjson( in );
+                break;
+            case FileEncoding::BSON:
+                j = nlohmann::json::from_bson( in );
+                break;
+        }
+    }
+
+
+    void JSONIOHandlerImpl::parseJson(
+        char const * begin,
+        char const * end,
+        nlohmann::json & j,
+        FileEncoding encoding,
+        bool deferDatasets
+    )
+    {
+        switch( encoding )
+        {
+            case FileEncoding::Text:
+                if( deferDatasets )
+                {
+                    Cursor cursor( begin, end );
+                    parseDeferringDatasets( cursor, j );
+                }
+                else
+                {
+                    j = nlohmann::json::parse( begin, end );
+                }
+                break;
+            case FileEncoding::CBOR:
+                j = nlohmann::json::from_cbor( begin, end );
+                break;
+            case FileEncoding::MessagePack:
+                j = nlohmann::json::from_msgpack( begin, end );
+                break;
+            case FileEncoding::UBJSON:
+                j = nlohmann::json::from_ubjson( begin, end );
+                break;
+            case FileEncoding::BSON:
+                j = nlohmann::json::from_bson( begin, end );
+                break;
+        }
+    }
+
+
+    bool JSONIOHandlerImpl::parseMappedFile(
+        std::string const & path,
+        nlohmann::json & j,
+        FileEncoding encoding,
+        bool deferDatasets
+    )
+    {
+        MappedFile file( path );
+        if( !file.valid( ) )
+        {
+            return false;
+        }
+        parseJson(
+            file.begin( ),
+            file.end( ),
+            j,
+            encoding,
+            deferDatasets
+        );
+        return true;
+    }
+
+
+    void JSONIOHandlerImpl::dumpJson(
+        std::ostream & out,
+        nlohmann::json const & j,
+        FileEncoding encoding,
+        bool pretty
+    )
+    {
+        switch( encoding )
+        {
+            case FileEncoding::Text:
+                // nlohmann::json serializes directly into the stream,
+                // without whitespace unless a width is set, and prints
+                // floating point numbers in their shortest form that
+                // parses back to the same value
+                if( pretty )
+                {
+                    out << std::setw( 2 );
+                }
+                out << j << std::endl;
+                break;
+            case FileEncoding::CBOR:
+                nlohmann::json::to_cbor( j, out );
+                break;
+            case FileEncoding::MessagePack:
+                nlohmann::json::to_msgpack( j, out );
+                break;
+            case FileEncoding::UBJSON:
+                // size- and type-annotated containers, i.e. homogeneous
+                // arrays are stored as typed binary arrays
+                nlohmann::json::to_ubjson( j, out, true, true );
+                break;
+            case FileEncoding::BSON:
+                nlohmann::json::to_bson( j, out );
+                break;
+        }
+    }
+
+
     std::string JSONIOHandlerImpl::fullPath( File fileName )
     {
         return fullPath( *fileName );
@@ -1211,6 +2784,41 @@ namespace openPMD
     }
 
 
+    template<
+        typename T,
+        typename Visitor
+    >
+    void JSONIOHandlerImpl::syncFlatJson(
+        nlohmann::json & j,
+        Extent const & datasetExtent,
+        Offset const & offset,
+        Extent const & extent,
+        Visitor visitor,
+        T * data
+    )
+    {
+        forEachRow(
+            datasetExtent,
+            offset,
+            extent,
+            [ &j, &visitor, data ](
+                size_t datasetIndex,
+                size_t bufferIndex,
+                size_t length
+            )
+            {
+                for( size_t i = 0; i < length; ++i )
+                {
+                    visitor(
+                        j[datasetIndex + i],
+                        data[bufferIndex + i]
+                    );
+                }
+            }
+        );
+    }
+
+
     // multiplicators: an array [m_0,...,m_n] s.t.
     // data[i_0]...[i_n] = data[m_0*i_0+...+m_n*i_n]
     // (m_n = 1)
@@ -1253,12 +2861,25 @@ namespace openPMD
 
     Extent JSONIOHandlerImpl::getExtent( nlohmann::json & j )
     {
+        auto flatExtent = j.find( "extent" );
+        if( flatExtent != j.end( ) )
+        {
+            return flatExtent->get< Extent >( );
+        }
         Extent res;
-        nlohmann::json * ptr = &j["data"];
-        while( ptr->is_array( ) )
+        auto deferred = j.find( deferredDataKey );
+        if( deferred != j.end( ) )
+        {
+            res = ( *deferred )[ "shape" ].get< Extent >( );
+        }
+        else
         {
-            res.push_back( ptr->size( ) );
-            ptr = &( *ptr )[0];
+            nlohmann::json * ptr = &j["data"];
+            while( ptr->is_array( ) )
+            {
+                res.push_back( ptr->size( ) );
+                ptr = &( *ptr )[0];
+            }
         }
         switch( stringToDatatype( j["datatype"].get<std::string>() ) )
         {
@@ -1276,6 +2897,31 @@ namespace openPMD
     }
 
 
+    void JSONIOHandlerImpl::loadDeferredData(
+        Writable * writable,
+        nlohmann::json & dataset
+    )
+    {
+        auto deferred = dataset.find( deferredDataKey );
+        if( deferred == dataset.end( ) )
+        {
+            return;
+        }
+        auto const begin = ( *deferred )[ "begin" ].get< size_t >( );
+        auto const end = ( *deferred )[ "end" ].get< size_t >( );
+        std::ifstream file(
+            fullPath( refreshFileFromParent( writable ) ),
+            std::ios_base::binary );
+        file.seekg( static_cast< std::streamoff >( begin ) );
+        std::string buffer( end - begin, '\0' );
+        file.read( &buffer[ 0 ], static_cast< std::streamsize >( buffer.size( ) ) );
+        VERIFY_ALWAYS( file.good( ),
+            "[JSON] Failed reading a dataset from its file." );
+        dataset[ "data" ] = nlohmann::json::parse( buffer );
+        dataset.erase( deferred );
+    }
+
+
     std::string JSONIOHandlerImpl::removeSlashes( std::string s )
     {
         if( auxiliary::starts_with(
@@ -1314,11 +2960,12 @@ namespace openPMD
     }
 
 
-    void JSONIOHandlerImpl::ensurePath(
+    bool JSONIOHandlerImpl::ensurePath(
         nlohmann::json * jsonp,
         std::string path
     )
     {
+        bool created = false;
         auto groups = auxiliary::split(
             path,
             "/"
@@ -1332,8 +2979,10 @@ namespace openPMD
             if (jsonp->is_null())
             {
                 *jsonp = nlohmann::json::object();
+                created = true;
             }
         }
+        return created;
     }
 
 
@@ -1367,8 +3016,32 @@ namespace openPMD
         File name;
         if( it == m_files.end( ) )
         {
-            name = file;
-            newlyCreated = true;
+            // a closed file may still be cached
+            auto cached = std::find_if(
+                m_jsonVals.begin( ),
+                m_jsonVals.end( ),
+                [&file](
+                    std::unordered_map<
+                        File,
+                        CachedFile
+                    >::value_type const & entry
+                )
+                {
+                    return *entry.first == file &&
+                           entry.first
+                               .valid( );
+                }
+            );
+            if( cached == m_jsonVals.end( ) )
+            {
+                name = file;
+                newlyCreated = true;
+            }
+            else
+            {
+                name = cached->first;
+                newlyCreated = false;
+            }
         }
         else
         {
@@ -1398,26 +3071,119 @@ namespace openPMD
         auto it = m_jsonVals.find( file );
         if( it != m_jsonVals.end( ) )
         {
-            return it->second;
+            // mark as most recently used
+            m_lru.splice(
+                m_lru.begin( ),
+                m_lru,
+                it->second.lruPosition
+            );
+            return it->second.contents;
+        }
+        if( m_prefetcher )
+        {
+            auto prefetched = m_prefetcher->take( fullPath( file ) );
+            if( prefetched )
+            {
+                cacheFile(
+                    file,
+                    prefetched,
+                    fileSize( fullPath( file ) )
+                );
+                return prefetched;
+            }
         }
-        // read from file
-        auto fh = getFilehandle(
-            file,
-            Access::READ_ONLY
-        );
         std::shared_ptr< nlohmann::json >
             res = std::make_shared< nlohmann::json >( );
-        *fh >> *res;
-        VERIFY( fh->good( ),
-            "[JSON] Failed reading from a file." );
-        m_jsonVals.emplace(
+        if( !m_mmap || !parseMappedFile(
+            fullPath( file ),
+            *res,
+            m_encoding,
+            m_deferDatasets
+        ) )
+        {
+            // read from file
+            auto fh = getFilehandle(
+                file,
+                Access::READ_ONLY
+            );
+            parseJson(
+                *fh,
+                *res,
+                m_encoding,
+                m_deferDatasets
+            );
+            // binary decoders may hit the end of the file
+            VERIFY( !fh->fail( ),
+                "[JSON] Failed reading from a file." );
+        }
+        cacheFile(
             file,
-            res
+            res,
+            fileSize( fullPath( file ) )
         );
         return res;
     }
 
 
+    void JSONIOHandlerImpl::cacheFile(
+        File const & file,
+        std::shared_ptr< nlohmann::json > contents,
+        size_t bytes
+    )
+    {
+        uncacheFile( file );
+        m_lru.push_front( file );
+        CachedFile cached;
+        cached.contents = std::move( contents );
+        cached.bytes = bytes;
+        cached.lruPosition = m_lru.begin( );
+        m_jsonVals.emplace(
+            file,
+            std::move( cached )
+        );
+        m_cachedBytes += bytes;
+        evictFiles( file );
+    }
+
+
+    void JSONIOHandlerImpl::uncacheFile( File const & file )
+    {
+        auto it = m_jsonVals.find( file );
+        if( it != m_jsonVals.end( ) )
+        {
+            m_cachedBytes -= it->second.bytes;
+            m_lru.erase( it->second.lruPosition );
+            m_jsonVals.erase( it );
+        }
+    }
+
+
+    void JSONIOHandlerImpl::evictFiles( File const & keep )
+    {
+        auto lruIt = m_lru.end( );
+        while( m_cachedBytes > m_cacheSize || m_cacheSize == 0 )
+        {
+            if( lruIt == m_lru.begin( ) )
+            {
+                break;
+            }
+            --lruIt;
+            if( *lruIt == keep )
+            {
+                continue;
+            }
+            File file = *lruIt;
+            // step back to the more recently used neighbor before erasing
+            ++lruIt;
+            if( m_dirty.find( file ) != m_dirty.end( ) )
+            {
+                putJsonContents( file );
+            }
+            uncacheFile( file );
+        }
+    }
+
+
     nlohmann::json &
     JSONIOHandlerImpl::obtainJsonContents( Writable * writable )
     {
@@ -1440,15 +3206,13 @@ namespace openPMD
         auto it = m_jsonVals.find( filename );
         if( it != m_jsonVals.end( ) )
         {
-            auto fh = getFilehandle(
-                    filename,
-                    Access::CREATE
+            auto const bytes = writeJsonFile(
+                filename,
+                *it->second.contents
             );
-            ( *it->second )["platform_byte_widths"] = platformSpecifics( );
-            *fh << *it->second << std::endl;
-            VERIFY( fh->good( ),
-                "[JSON] Failed writing data to disk." )
-            m_jsonVals.erase( it );
+            m_cachedBytes -= it->second.bytes;
+            it->second.bytes = bytes;
+            m_cachedBytes += it->second.bytes;
             if( unsetDirty )
             {
                 m_dirty.erase( filename );
@@ -1458,6 +3222,29 @@ namespace openPMD
     }
 
 
+    size_t JSONIOHandlerImpl::writeJsonFile(
+        File const & filename,
+        nlohmann::json & contents
+    )
+    {
+        auto fh = getFilehandle(
+                filename,
+                Access::CREATE
+        );
+        contents["platform_byte_widths"] = platformSpecifics( );
+        dumpJson(
+            *fh,
+            contents,
+            m_encoding,
+            m_pretty
+        );
+        VERIFY( fh->good( ),
+            "[JSON] Failed writing data to disk." )
+        auto const bytes = fh->tellp( );
+        return bytes > 0 ? static_cast< size_t >( bytes ) : 0;
+    }
+
+
     std::shared_ptr< JSONFilePosition >
     JSONIOHandlerImpl::setAndGetFilePosition(
         Writable * writable,
@@ -1566,7 +3353,15 @@ namespace openPMD
             return false;
         }
         auto i = j.find( "data" );
-        return i != j.end( ) && i.value( ).is_array();
+        return i != j.end( ) &&
+            ( i.value( ).is_array() || i.value( ).is_string() );
+    }
+
+
+    bool JSONIOHandlerImpl::isBase64Dataset( nlohmann::json const & j )
+    {
+        auto i = j.find( "data" );
+        return i != j.end( ) && i.value( ).is_string();
     }
 
 
@@ -1578,7 +3373,8 @@ namespace openPMD
             return false;
         }
         auto i = j.find( "data" );
-        return i == j.end( ) || !i.value( ).is_array();
+        return i == j.end( ) ||
+            !( i.value( ).is_array() || i.value( ).is_string() );
     }
 
 
@@ -1659,18 +3455,60 @@ namespace openPMD
     )
     {
         CppToJSON< T > ctj;
+        auto visitor = [&ctj](
+            nlohmann::json & j,
+            T const & data
+        )
+        {
+            j = ctj( data );
+        };
+        if( isBase64Dataset( json ) )
+        {
+            auto & base64 = json["data"].get_ref< std::string & >( );
+            auto const datasetExtent = getExtent( json );
+            size_t const totalBytes = numElements( datasetExtent ) * sizeof( T );
+            auto const * data =
+                static_cast< char const * >( parameters.data.get( ) );
+            forEachRow(
+                datasetExtent,
+                parameters.offset,
+                parameters.extent,
+                [ &base64, totalBytes, data ](
+                    size_t datasetIndex,
+                    size_t bufferIndex,
+                    size_t length
+                )
+                {
+                    writeBase64Bytes(
+                        base64,
+                        totalBytes,
+                        datasetIndex * sizeof( T ),
+                        length * sizeof( T ),
+                        data + bufferIndex * sizeof( T )
+                    );
+                }
+            );
+            return;
+        }
+        if( json.contains( "extent" ) )
+        {
+            syncFlatJson(
+                json["data"],
+                getExtent( json ),
+                parameters.offset,
+                parameters.extent,
+                visitor,
+                static_cast<T const *>(parameters.data
+                    .get( ))
+            );
+            return;
+        }
         syncMultidimensionalJson(
             json["data"],
             parameters.offset,
             parameters.extent,
             getMultiplicators( parameters.extent ),
-            [&ctj](
-                nlohmann::json & j,
-                T const & data
-            )
-            {
-                j = ctj( data );
-            },
+            visitor,
             static_cast<T const *>(parameters.data
                 .get( ))
         );
@@ -1686,18 +3524,59 @@ namespace openPMD
         JsonToCpp<
             T
         > jtc;
+        auto visitor = [&jtc](
+            nlohmann::json & j,
+            T & data
+        )
+        {
+            data = jtc( j );
+        };
+        if( isBase64Dataset( json ) )
+        {
+            auto const & base64 = json["data"].get_ref< std::string const & >( );
+            VERIFY_ALWAYS( base64.size( ) == base64Length(
+                    numElements( getExtent( json ) ) * sizeof( T ) ),
+                "[JSON] Size of base64 data does not match the dataset." );
+            auto * data = static_cast< char * >( parameters.data.get( ) );
+            forEachRow(
+                getExtent( json ),
+                parameters.offset,
+                parameters.extent,
+                [ &base64, data ](
+                    size_t datasetIndex,
+                    size_t bufferIndex,
+                    size_t length
+                )
+                {
+                    readBase64Bytes(
+                        base64,
+                        datasetIndex * sizeof( T ),
+                        length * sizeof( T ),
+                        data + bufferIndex * sizeof( T )
+                    );
+                }
+            );
+            return;
+        }
+        if( json.contains( "extent" ) )
+        {
+            syncFlatJson(
+                json["data"],
+                getExtent( json ),
+                parameters.offset,
+                parameters.extent,
+                visitor,
+                static_cast<T *>(parameters.data
+                    .get( ))
+            );
+            return;
+        }
         syncMultidimensionalJson(
-            json,
+            json["data"],
             parameters.offset,
             parameters.extent,
             getMultiplicators( parameters.extent ),
-            [&jtc](
-                nlohmann::json & j,
-                T & data
-            )
-            {
-                data = jtc( j );
-            },
+            visitor,
             static_cast<T *>(parameters.data
                 .get( ))
         );
@@ -82,6 +82,7 @@ using iterator_t = Container< Iteration, uint64_t >::iterator;
 Iteration &
 Iteration::close( bool _flush )
 {
+    IOTracer::Scope trace( IOHandler()->m_tracer, "Iteration::close" );
     using bool_type = unsigned char;
     if( this->IOHandler()->m_frontendAccess != Access::READ_ONLY )
     {
@@ -390,8 +391,7 @@ void Iteration::read_impl( std::string const & groupPath )
     Parameter< Operation::READ_ATT > aRead;
 
     aRead.name = "dt";
-    IOHandler()->enqueue(IOTask(this, aRead));
-    IOHandler()->flush();
+    readAttribute( aRead );
     if( *aRead.dtype == DT::FLOAT )
         setDt(Attribute(*aRead.resource).get< float >());
     else if( *aRead.dtype == DT::DOUBLE )
@@ -400,8 +400,7 @@ void Iteration::read_impl( std::string const & groupPath )
         throw std::runtime_error("Unexpected Attribute datatype for 'dt'");
 
     aRead.name = "time";
-    IOHandler()->enqueue(IOTask(this, aRead));
-    IOHandler()->flush();
+    readAttribute( aRead );
     if( *aRead.dtype == DT::FLOAT )
         setTime(Attribute(*aRead.resource).get< float >());
     else if( *aRead.dtype == DT::DOUBLE )
@@ -410,8 +409,7 @@ void Iteration::read_impl( std::string const & groupPath )
         throw std::runtime_error("Unexpected Attribute datatype for 'time'");
 
     aRead.name = "timeUnitSI";
-    IOHandler()->enqueue(IOTask(this, aRead));
-    IOHandler()->flush();
+    readAttribute( aRead );
     if( *aRead.dtype == DT::DOUBLE )
         setTimeUnitSI(Attribute(*aRead.resource).get< double >());
     else
@@ -459,21 +457,14 @@ void Iteration::read_impl( std::string const & groupPath )
         IOHandler()->enqueue(IOTask(&meshes, pList));
         IOHandler()->flush();
 
-        Parameter< Operation::LIST_ATTS > aList;
         for( auto const& mesh_name : *pList.paths )
         {
             Mesh& m = map[mesh_name];
             pOpen.path = mesh_name;
-            aList.attributes->clear();
             IOHandler()->enqueue(IOTask(&m, pOpen));
-            IOHandler()->enqueue(IOTask(&m, aList));
-            IOHandler()->flush();
 
-            auto att_begin = aList.attributes->begin();
-            auto att_end = aList.attributes->end();
-            auto value = std::find(att_begin, att_end, "value");
-            auto shape = std::find(att_begin, att_end, "shape");
-            if( value != att_end && shape != att_end )
+            if( m.containsAttributeInBackend( "value" ) &&
+                m.containsAttributeInBackend( "shape" ) )
             {
                 MeshRecordComponent& mrc = m[MeshRecordComponent::SCALAR];
                 mrc.parent() = m.parent();
@@ -674,9 +665,8 @@ Iteration::dirtyRecursive() const
 }
 
 void
-Iteration::linkHierarchy(Writable& w)
+Iteration::relinkChildren()
 {
-    AttributableImpl::linkHierarchy(w);
     meshes.linkHierarchy(this->writable());
     particles.linkHierarchy(this->writable());
 }
@@ -703,6 +693,14 @@ void Iteration::runDeferredParseAccess()
     *newAccess = oldAccess;
 }
 
+void traits::AccessPolicy< Iteration >::operator()( Iteration & iteration )
+{
+    if( *iteration.m_closed == Iteration::CloseStatus::ParseAccessDeferred )
+    {
+        iteration.open();
+    }
+}
+
 template float
 Iteration::time< float >() const;
 template double
@@ -280,8 +280,7 @@ Mesh::read()
     Parameter< Operation::READ_ATT > aRead;
 
     aRead.name = "geometry";
-    IOHandler()->enqueue(IOTask(this, aRead));
-    IOHandler()->flush();
+    readAttribute( aRead );
     if( *aRead.dtype == DT::STRING )
     {
         std::string tmpGeometry = Attribute(*aRead.resource).get< std::string >();
@@ -300,8 +299,7 @@ Mesh::read()
         throw std::runtime_error("Unexpected Attribute datatype for 'geometry'");
 
     aRead.name = "dataOrder";
-    IOHandler()->enqueue(IOTask(this, aRead));
-    IOHandler()->flush();
+    readAttribute( aRead );
     if( *aRead.dtype == DT::CHAR )
         setDataOrder(static_cast<DataOrder>(Attribute(*aRead.resource).get< char >()));
     else if( *aRead.dtype == DT::STRING )
@@ -316,8 +314,7 @@ Mesh::read()
         throw std::runtime_error("Unexpected Attribute datatype for 'dataOrder'");
 
     aRead.name = "axisLabels";
-    IOHandler()->enqueue(IOTask(this, aRead));
-    IOHandler()->flush();
+    readAttribute( aRead );
     if( *aRead.dtype == DT::VEC_STRING )
         setAxisLabels(Attribute(*aRead.resource).get< std::vector< std::string > >());
     else if( *aRead.dtype == DT::STRING )
@@ -326,8 +323,7 @@ Mesh::read()
         throw std::runtime_error("Unexpected Attribute datatype for 'axisLabels'");
 
     aRead.name = "gridSpacing";
-    IOHandler()->enqueue(IOTask(this, aRead));
-    IOHandler()->flush();
+    readAttribute( aRead );
     Attribute a = Attribute(*aRead.resource);
     if( *aRead.dtype == DT::VEC_FLOAT )
         setGridSpacing(a.get< std::vector< float > >());
@@ -341,8 +337,7 @@ Mesh::read()
         throw std::runtime_error("Unexpected Attribute datatype for 'gridSpacing'");
 
     aRead.name = "gridGlobalOffset";
-    IOHandler()->enqueue(IOTask(this, aRead));
-    IOHandler()->flush();
+    readAttribute( aRead );
     if( *aRead.dtype == DT::VEC_DOUBLE )
         setGridGlobalOffset(Attribute(*aRead.resource).get< std::vector< double > >());
     else if( *aRead.dtype == DT::DOUBLE )
@@ -351,8 +346,7 @@ Mesh::read()
         throw std::runtime_error("Unexpected Attribute datatype for 'gridGlobalOffset'");
 
     aRead.name = "gridUnitSI";
-    IOHandler()->enqueue(IOTask(this, aRead));
-    IOHandler()->flush();
+    readAttribute( aRead );
     if( *aRead.dtype == DT::DOUBLE )
         setGridUnitSI(Attribute(*aRead.resource).get< double >());
     else
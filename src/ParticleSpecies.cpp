@@ -45,7 +45,6 @@ ParticleSpecies::read()
     auto map = eraseStaleEntries();
 
     Parameter< Operation::OPEN_PATH > pOpen;
-    Parameter< Operation::LIST_ATTS > aList;
     bool hasParticlePatches = false;
     for( auto const& record_name : *pList.paths )
     {
@@ -59,16 +58,10 @@ ParticleSpecies::read()
         {
             Record& r = map[record_name];
             pOpen.path = record_name;
-            aList.attributes->clear();
             IOHandler()->enqueue(IOTask(&r, pOpen));
-            IOHandler()->enqueue(IOTask(&r, aList));
-            IOHandler()->flush();
 
-            auto att_begin = aList.attributes->begin();
-            auto att_end = aList.attributes->end();
-            auto value = std::find(att_begin, att_end, "value");
-            auto shape = std::find(att_begin, att_end, "shape");
-            if( value != att_end && shape != att_end )
+            if( r.containsAttributeInBackend( "value" ) &&
+                r.containsAttributeInBackend( "shape" ) )
             {
                 auto scalarMap = r.eraseStaleEntries();
                 RecordComponent& rc = scalarMap[RecordComponent::SCALAR];
@@ -168,6 +161,13 @@ ParticleSpecies::flush(std::string const& path)
     }
 }
 
+void
+ParticleSpecies::relinkChildren()
+{
+    Container< Record >::relinkChildren();
+    particlePatches.linkHierarchy( writable() );
+}
+
 bool
 ParticleSpecies::dirtyRecursive() const
 {
@@ -89,6 +89,7 @@ RecordComponent::resetDataset( Dataset d )
     }
 
     dirty() = true;
+    markIterationDirty();
     return *this;
 }
 
@@ -164,6 +165,7 @@ RecordComponent::makeEmpty( Dataset d )
 
     *m_isEmpty = true;
     dirty() = true;
+    markIterationDirty();
     if( !written() )
     {
         static detail::DefaultValue< RecordComponent > dv;
@@ -219,6 +221,7 @@ RecordComponent::flush(std::string const& name)
                 dCreate.extent = getExtent();
                 dCreate.dtype = getDatatype();
                 dCreate.chunkSize = m_dataset->chunkSize;
+                dCreate.chunkSizeSpecified = m_dataset->chunkSizeSpecified;
                 dCreate.compression = m_dataset->compression;
                 dCreate.transform = m_dataset->transform;
                 dCreate.options = m_dataset->options;
@@ -271,8 +274,7 @@ RecordComponent::readBase()
     if( constant() && !empty() )
     {
         aRead.name = "value";
-        IOHandler()->enqueue(IOTask(this, aRead));
-        IOHandler()->flush();
+        readAttribute( aRead );
 
         Attribute a(*aRead.resource);
         DT dtype = *aRead.dtype;
@@ -336,8 +338,7 @@ RecordComponent::readBase()
         written() = true;
 
         aRead.name = "shape";
-        IOHandler()->enqueue(IOTask(this, aRead));
-        IOHandler()->flush();
+        readAttribute( aRead );
         a = Attribute(*aRead.resource);
         Extent e;
 
@@ -365,8 +366,7 @@ RecordComponent::readBase()
     }
 
     aRead.name = "unitSI";
-    IOHandler()->enqueue(IOTask(this, aRead));
-    IOHandler()->flush();
+    readAttribute( aRead );
     if( *aRead.dtype == DT::DOUBLE )
         setUnitSI(Attribute(*aRead.resource).get< double >());
     else
@@ -19,22 +19,28 @@
  * If not, see <http://www.gnu.org/licenses/>.
  */
 #include "openPMD/auxiliary/Date.hpp"
+#include "openPMD/auxiliary/Environment.hpp"
 #include "openPMD/auxiliary/Filesystem.hpp"
 #include "openPMD/auxiliary/JSON.hpp"
 #include "openPMD/auxiliary/StringManip.hpp"
 #include "openPMD/IO/AbstractIOHandler.hpp"
 #include "openPMD/IO/AbstractIOHandlerHelper.hpp"
+#include "openPMD/IO/AsyncIOHandler.hpp"
 #include "openPMD/IO/Format.hpp"
 #include "openPMD/ReadIterations.hpp"
 #include "openPMD/Series.hpp"
 #include "openPMD/version.hpp"
 
+#include <algorithm>
 #include <exception>
+#include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <map>
 #include <regex>
 #include <set>
 #include <string>
+#include <thread>
 #include <tuple>
 
 
@@ -344,9 +350,16 @@ SeriesImpl::backend() const
     return IOHandler()->backendName();
 }
 
+IOStatistics
+SeriesImpl::ioStatistics() const
+{
+    return IOHandler()->statistics();
+}
+
 void
 SeriesImpl::flush()
 {
+    IOTracer::Scope trace( IOHandler()->m_tracer, "Series::flush" );
     auto & series = get();
     flush_impl(
         series.iterations.begin(),
@@ -354,6 +367,27 @@ SeriesImpl::flush()
         FlushLevel::UserFlush );
 }
 
+std::future< void >
+SeriesImpl::flushAsync()
+{
+    IOTracer::Scope trace( IOHandler()->m_tracer, "Series::flush" );
+    auto & series = get();
+    auto res = flush_impl(
+        series.iterations.begin(),
+        series.iterations.end(),
+        FlushLevel::UserFlush );
+    // the caller learns about errors in the background through the future
+    IOHandler()->forwardErrorsToFuture();
+    if( !res.valid() )
+    {
+        // synchronous backends are done by now
+        std::promise< void > done;
+        done.set_value();
+        res = done.get_future();
+    }
+    return res;
+}
+
 std::unique_ptr< SeriesImpl::ParsedInput >
 SeriesImpl::parseInput(std::string filepath)
 {
@@ -424,6 +458,7 @@ void SeriesImpl::init(
 {
     auto & series = get();
     writable().IOHandler = ioHandler;
+    writable().activeIterations = series.m_activeIterations;
     series.iterations.linkHierarchy(writable());
     series.iterations.writable().ownKeyWithinParent = { "iterations" };
 
@@ -505,6 +540,11 @@ SeriesImpl::flush_impl(
     series.m_lastFlushSuccessful = true;
     try
     {
+        /*
+         * The frontend modifies Writables below, so anything still running
+         * in the background from a previous flush must complete first.
+         */
+        IOHandler()->awaitPendingFlush();
         switch( iterationEncoding() )
         {
             using IE = IterationEncoding;
@@ -543,9 +583,10 @@ SeriesImpl::flushFileBased( iterations_iterator begin, iterations_iterator end )
     if( end == begin )
         throw std::runtime_error(
             "fileBased output can not be written with no iterations." );
+    auto const flushed = iterationsToFlush( begin, end );
 
     if( IOHandler()->m_frontendAccess == Access::READ_ONLY )
-        for( auto it = begin; it != end; ++it )
+        for( auto it : flushed )
         {
             if( *it->second.m_closed
                 == Iteration::CloseStatus::ParseAccessDeferred )
@@ -594,7 +635,7 @@ SeriesImpl::flushFileBased( iterations_iterator begin, iterations_iterator end )
     else
     {
         bool allDirty = dirty();
-        for( auto it = begin; it != end; ++it )
+        for( auto it : flushed )
         {
             if( *it->second.m_closed
                 == Iteration::CloseStatus::ParseAccessDeferred )
@@ -632,6 +673,11 @@ SeriesImpl::flushFileBased( iterations_iterator begin, iterations_iterator end )
              */
             if( dirtyRecursive || this->dirty() )
             {
+                /*
+                 * The background tasks of the previous iteration's flush
+                 * still write to the Series' Writables.
+                 */
+                IOHandler()->awaitPendingFlush();
                 /* as there is only one series,
                 * emulate the file belonging to each iteration as not yet written
                 */
@@ -677,14 +723,16 @@ SeriesImpl::flushFileBased( iterations_iterator begin, iterations_iterator end )
         }
         dirty() = false;
     }
+    trackActiveIterations( flushed );
 }
 
 void
 SeriesImpl::flushGorVBased( iterations_iterator begin, iterations_iterator end )
 {
     auto & series = get();
+    auto const flushed = iterationsToFlush( begin, end );
     if( IOHandler()->m_frontendAccess == Access::READ_ONLY )
-        for( auto it = begin; it != end; ++it )
+        for( auto it : flushed )
         {
             if( *it->second.m_closed
                 == Iteration::CloseStatus::ParseAccessDeferred )
@@ -726,7 +774,7 @@ SeriesImpl::flushGorVBased( iterations_iterator begin, iterations_iterator end )
 
         series.iterations.flush(auxiliary::replace_first(basePath(), "%T/", ""));
 
-        for( auto it = begin; it != end; ++it )
+        for( auto it : flushed )
         {
             if( *it->second.m_closed
                 == Iteration::CloseStatus::ParseAccessDeferred )
@@ -781,6 +829,65 @@ SeriesImpl::flushGorVBased( iterations_iterator begin, iterations_iterator end )
         flushAttributes();
         IOHandler()->flush();
     }
+    trackActiveIterations( flushed );
+}
+
+std::vector< SeriesImpl::iterations_iterator >
+SeriesImpl::iterationsToFlush(
+    iterations_iterator begin, iterations_iterator end )
+{
+    auto & series = get();
+    std::vector< iterations_iterator > res;
+    if( begin != series.iterations.begin() || end != series.iterations.end() )
+    {
+        for( auto it = begin; it != end; ++it )
+            res.push_back( it );
+        return res;
+    }
+    /*
+     * Flushing the whole Series: iterations that are closed in the backend
+     * or not yet parsed are skipped anyway unless they have been modified
+     * since (which is an error to be reported), so only look at the ones
+     * that are still active.
+     */
+    res.reserve( series.m_activeIterations->size() );
+    for( auto index = series.m_activeIterations->begin();
+         index != series.m_activeIterations->end(); )
+    {
+        auto it = series.iterations.find( *index );
+        if( it == series.iterations.end() )
+        {
+            // iteration has been erased in the meantime
+            index = series.m_activeIterations->erase( index );
+            continue;
+        }
+        res.push_back( it );
+        ++index;
+    }
+    return res;
+}
+
+void
+SeriesImpl::trackActiveIterations(
+    std::vector< iterations_iterator > const & flushed )
+{
+    auto & series = get();
+    for( auto it : flushed )
+    {
+        switch( *it->second.m_closed )
+        {
+            using CL = Iteration::CloseStatus;
+            case CL::ClosedInBackend:
+            case CL::ParseAccessDeferred:
+                series.m_activeIterations->erase( it->first );
+                break;
+            case CL::Open:
+            case CL::ClosedTemporarily:
+            case CL::ClosedInFrontend:
+                series.m_activeIterations->insert( it->first );
+                break;
+        }
+    }
 }
 
 void
@@ -823,6 +930,7 @@ SeriesImpl::readFileBased( )
     int padding;
     uint64_t iterationIndex;
     std::set< int > paddings;
+    std::map< uint64_t, std::string > files;
     for( auto const& entry : auxiliary::list_directory(IOHandler()->directory) )
     {
         std::tie(isContained, padding, iterationIndex) = isPartOfSeries(entry);
@@ -834,6 +942,7 @@ SeriesImpl::readFileBased( )
                 iterationIndex,
                 true,
                 entry } );
+            files[ iterationIndex ] = entry;
             // TODO skip if the padding is exact the number of chars in an iteration?
             paddings.insert(padding);
         }
@@ -872,6 +981,23 @@ SeriesImpl::readFileBased( )
     }
     else
     {
+        if( series.m_parsingThreads > 1 &&
+            !IOHandler()->supportsPrefetch() )
+        {
+            std::cerr << "[Series] The key 'parsing_threads' is only "
+                         "implemented by the JSON backend, files of backend "
+                      << IOHandler()->backendName()
+                      << " will be loaded sequentially." << std::endl;
+        }
+        else if( series.m_parsingThreads > 1 )
+        {
+            // files are parsed in the order of series.iterations
+            Parameter< Operation::PREFETCH_FILES > fPrefetch;
+            fPrefetch.threads = series.m_parsingThreads;
+            for( auto const & file : files )
+                fPrefetch.names.push_back( file.second );
+            IOHandler()->enqueue( IOTask( this, fPrefetch ) );
+        }
         for( auto & iteration : series.iterations )
         {
             readIterationEagerly( iteration.second );
@@ -904,8 +1030,7 @@ void SeriesImpl::readOneIterationFileBased( std::string const & filePath )
 
     using DT = Datatype;
     aRead.name = "iterationEncoding";
-    IOHandler()->enqueue( IOTask( this, aRead ) );
-    IOHandler()->flush();
+    readAttribute( aRead );
     if( *aRead.dtype == DT::STRING )
     {
         std::string encoding =
@@ -942,8 +1067,7 @@ void SeriesImpl::readOneIterationFileBased( std::string const & filePath )
                                     "for 'iterationEncoding'" );
 
     aRead.name = "iterationFormat";
-    IOHandler()->enqueue( IOTask( this, aRead ) );
-    IOHandler()->flush();
+    readAttribute( aRead );
     if( *aRead.dtype == DT::STRING )
     {
         written() = false;
@@ -984,8 +1108,7 @@ SeriesImpl::readGorVBased( bool do_init )
         using DT = Datatype;
         Parameter< Operation::READ_ATT > aRead;
         aRead.name = "iterationEncoding";
-        IOHandler()->enqueue(IOTask(this, aRead));
-        IOHandler()->flush();
+        readAttribute( aRead );
         if( *aRead.dtype == DT::STRING )
         {
             std::string encoding = Attribute(*aRead.resource).get< std::string >();
@@ -1012,8 +1135,7 @@ SeriesImpl::readGorVBased( bool do_init )
             throw std::runtime_error("Unexpected Attribute datatype for 'iterationEncoding'");
 
         aRead.name = "iterationFormat";
-        IOHandler()->enqueue(IOTask(this, aRead));
-        IOHandler()->flush();
+        readAttribute( aRead );
         if( *aRead.dtype == DT::STRING )
         {
             written() = false;
@@ -1049,7 +1171,8 @@ SeriesImpl::readGorVBased( bool do_init )
         if( series.iterations.contains( index ) )
         {
             // maybe re-read
-            auto & i = series.iterations.at( index );
+            // (not via at(), which would parse deferred iterations)
+            auto & i = series.iterations.find( index )->second;
             if( guardClosed && i.closedByWriter() )
             {
                 return;
@@ -1114,37 +1237,30 @@ SeriesImpl::readBase()
     Parameter< Operation::READ_ATT > aRead;
 
     aRead.name = "openPMD";
-    IOHandler()->enqueue(IOTask(this, aRead));
-    IOHandler()->flush();
+    readAttribute( aRead );
     if( *aRead.dtype == DT::STRING )
         setOpenPMD(Attribute(*aRead.resource).get< std::string >());
     else
         throw std::runtime_error("Unexpected Attribute datatype for 'openPMD'");
 
     aRead.name = "openPMDextension";
-    IOHandler()->enqueue(IOTask(this, aRead));
-    IOHandler()->flush();
+    readAttribute( aRead );
     if( *aRead.dtype == determineDatatype< uint32_t >() )
         setOpenPMDextension(Attribute(*aRead.resource).get< uint32_t >());
     else
         throw std::runtime_error("Unexpected Attribute datatype for 'openPMDextension'");
 
     aRead.name = "basePath";
-    IOHandler()->enqueue(IOTask(this, aRead));
-    IOHandler()->flush();
+    readAttribute( aRead );
     if( *aRead.dtype == DT::STRING )
         setAttribute("basePath", Attribute(*aRead.resource).get< std::string >());
     else
         throw std::runtime_error("Unexpected Attribute datatype for 'basePath'");
 
-    Parameter< Operation::LIST_ATTS > aList;
-    IOHandler()->enqueue(IOTask(this, aList));
-    IOHandler()->flush();
-    if( std::count(aList.attributes->begin(), aList.attributes->end(), "meshesPath") == 1 )
+    if( containsAttributeInBackend( "meshesPath" ) )
     {
         aRead.name = "meshesPath";
-        IOHandler()->enqueue(IOTask(this, aRead));
-        IOHandler()->flush();
+        readAttribute( aRead );
         if( *aRead.dtype == DT::STRING )
         {
             /* allow setting the meshes path after completed IO */
@@ -1160,11 +1276,10 @@ SeriesImpl::readBase()
             throw std::runtime_error("Unexpected Attribute datatype for 'meshesPath'");
     }
 
-    if( std::count(aList.attributes->begin(), aList.attributes->end(), "particlesPath") == 1 )
+    if( containsAttributeInBackend( "particlesPath" ) )
     {
         aRead.name = "particlesPath";
-        IOHandler()->enqueue(IOTask(this, aRead));
-        IOHandler()->flush();
+        readAttribute( aRead );
         if( *aRead.dtype == DT::STRING )
         {
             /* allow setting the meshes path after completed IO */
@@ -1201,6 +1316,17 @@ SeriesImpl::iterations_iterator
 SeriesImpl::indexOf( Iteration const & iteration )
 {
     auto & series = get();
+    // the key within Series::iterations is the iteration index
+    auto const & key = iteration.writable().ownKeyWithinParent;
+    if( key.size() == 1 )
+    {
+        auto it = series.iterations.find( std::stoull( key[ 0 ] ) );
+        if( it != series.iterations.end() &&
+            &it->second.Attributable::get() == &iteration.Attributable::get() )
+        {
+            return it;
+        }
+    }
     for( auto it = series.iterations.begin(); it != series.iterations.end();
          ++it )
     {
@@ -1374,7 +1500,16 @@ void getJsonOption(
 {
     if( config.contains( key ) )
     {
-        dest = config.at( key ).get< T >();
+        try
+        {
+            dest = config.at( key ).get< T >();
+        }
+        catch( nlohmann::json::type_error const & ex )
+        {
+            throw std::runtime_error(
+                "[Series] Invalid value for JSON option '" + key +
+                "': " + ex.what() );
+        }
     }
 }
 
@@ -1382,6 +1517,84 @@ void parseJsonOptions(
     internal::SeriesData & series, nlohmann::json const & options )
 {
     getJsonOption( options, "defer_iteration_parsing", series.m_parseLazily );
+    getJsonOption( options, "parsing_threads", series.m_parsingThreads );
+    if( series.m_parsingThreads == 0 )
+    {
+        series.m_parsingThreads =
+            std::max( std::thread::hardware_concurrency(), 1u );
+    }
+    getJsonOption( options, "asynchronous_flush", series.m_asynchronousFlush );
+    std::string statisticsFile;
+    getJsonOption( options, "statistics_file", statisticsFile );
+    if( !statisticsFile.empty() )
+        series.m_statisticsFile = statisticsFile;
+    std::string traceFile =
+        auxiliary::getEnvString( "OPENPMD_TRACE_FILE", "" );
+    getJsonOption( options, "trace_file", traceFile );
+    if( !traceFile.empty() )
+        series.m_traceFile = traceFile;
+}
+
+/*
+ * The JSON backend names its files after their encoding, so an encoding
+ * configured via json.encoding also determines the file ending that the
+ * Series creates and looks for.
+ */
+void applyJsonEncoding( Format & format, nlohmann::json const & options )
+{
+    switch( format )
+    {
+        case Format::JSON:
+        case Format::JSON_CBOR:
+        case Format::JSON_MSGPACK:
+        case Format::JSON_UBJSON:
+        case Format::JSON_BSON:
+            break;
+        default:
+            return;
+    }
+    if( !options.contains( "json" ) )
+        return;
+    std::string encoding;
+    getJsonOption( options.at( "json" ), "encoding", encoding );
+    if( encoding.empty() )
+        return;
+    if( encoding == "json" )
+        format = Format::JSON;
+    else if( encoding == "cbor" )
+        format = Format::JSON_CBOR;
+    else if( encoding == "msgpack" )
+        format = Format::JSON_MSGPACK;
+    else if( encoding == "ubjson" )
+        format = Format::JSON_UBJSON;
+    else if( encoding == "bson" )
+        format = Format::JSON_BSON;
+    else
+        throw std::runtime_error(
+            "[Series] Unknown JSON encoding '" + encoding +
+            "', expected one of json, cbor, msgpack, ubjson, bson." );
+}
+
+std::shared_ptr< AbstractIOHandler > wrapIOHandler(
+    internal::SeriesData const & series,
+    std::shared_ptr< AbstractIOHandler > handler,
+    Access at,
+    int rank = 0 )
+{
+    if( series.m_traceFile.has_value() )
+        handler->m_tracer =
+            std::make_shared< IOTracer >( series.m_traceFile.get(), rank );
+    // read-only Series only ever flush to read data, nothing to overlap
+    if( series.m_asynchronousFlush && at != Access::READ_ONLY )
+    {
+        if( handler->supportsBackgroundFlush() )
+            return std::make_shared< AsyncIOHandler >( std::move( handler ) );
+        std::cerr << "[Series] Backend " << handler->backendName()
+                  << " does not support asynchronous flushing (HDF5 must be "
+                     "built thread-safe). Will flush synchronously."
+                  << std::endl;
+    }
+    return handler;
 }
 }
 
@@ -1399,9 +1612,37 @@ SeriesInternal::SeriesInternal(
 {
     nlohmann::json optionsJson = auxiliary::parseOptions( options, comm );
     parseJsonOptions( *this, optionsJson );
+    if( m_asynchronousFlush )
+    {
+        int provided;
+        MPI_Query_thread( &provided );
+        if( provided < MPI_THREAD_MULTIPLE )
+        {
+            std::cerr << "[Series] Asynchronous flushing requires MPI to be "
+                         "initialized with MPI_THREAD_MULTIPLE. Will flush "
+                         "synchronously." << std::endl;
+            m_asynchronousFlush = false;
+        }
+    }
+    int size, rank;
+    MPI_Comm_size( comm, &size );
+    MPI_Comm_rank( comm, &rank );
+    if( size > 1 )
+    {
+        for( auto file : { &m_statisticsFile, &m_traceFile } )
+        {
+            if( file->has_value() )
+                *file = file->get() + "." + std::to_string( rank );
+        }
+    }
     auto input = parseInput( filepath );
-    auto handler = createIOHandler(
-        input->path, at, input->format, comm, std::move( optionsJson ) );
+    applyJsonEncoding( input->format, optionsJson );
+    auto handler = wrapIOHandler(
+        *this,
+        createIOHandler(
+            input->path, at, input->format, comm, std::move( optionsJson ) ),
+        at,
+        rank );
     init( handler, std::move( input ) );
 }
 #endif
@@ -1415,8 +1656,12 @@ SeriesInternal::SeriesInternal(
     nlohmann::json optionsJson = auxiliary::parseOptions( options );
     parseJsonOptions( *this, optionsJson );
     auto input = parseInput( filepath );
-    auto handler = createIOHandler(
-        input->path, at, input->format, std::move( optionsJson ) );
+    applyJsonEncoding( input->format, optionsJson );
+    auto handler = wrapIOHandler(
+        *this,
+        createIOHandler(
+            input->path, at, input->format, std::move( optionsJson ) ),
+        at );
     init( handler, std::move( input ) );
 }
 
@@ -1439,6 +1684,12 @@ SeriesInternal::~SeriesInternal()
         if( get().m_lastFlushSuccessful )
         {
             flush();
+            IOHandler()->awaitPendingFlush();
+        }
+        if( m_statisticsFile.has_value() )
+        {
+            std::ofstream out( m_statisticsFile.get() );
+            out << IOHandler()->statistics().toJSON() << std::endl;
         }
     }
     catch( std::exception const & ex )
@@ -1519,6 +1770,10 @@ namespace
             case Format::ADIOS2_SST:
             case Format::ADIOS2_SSC:
             case Format::JSON:
+            case Format::JSON_CBOR:
+            case Format::JSON_MSGPACK:
+            case Format::JSON_UBJSON:
+            case Format::JSON_BSON:
                 return auxiliary::replace_last(filename, suffix(f), "");
             default:
                 return filename;
@@ -1579,13 +1834,17 @@ namespace
                 nameReg += + ")" + postfix + ".ssc$";
                 return buildMatcher(nameReg);
             }
-            case Format::JSON: {
+            case Format::JSON:
+            case Format::JSON_CBOR:
+            case Format::JSON_MSGPACK:
+            case Format::JSON_UBJSON:
+            case Format::JSON_BSON: {
                 std::string nameReg = "^" + prefix + "([[:digit:]]";
                 if (padding != 0)
                     nameReg += "{" + std::to_string(padding) + "}";
                 else
                     nameReg += "+";
-                nameReg += +")" + postfix + ".json$";
+                nameReg += +")" + postfix + suffix(f) + "$";
                 return buildMatcher(nameReg);
             }
             default:
@@ -82,6 +82,28 @@ namespace auxiliary
                     toRemove.emplace_back( it.key() );
                 }
             }
+            else if( partialResult.is_array() && it.value().is_array() )
+            {
+                // keep the positions of the remaining entries
+                bool fullyRead = true;
+                for( size_t i = 0; i < partialResult.size(); ++i )
+                {
+                    nlohmann::json & entry = partialResult[ i ];
+                    if( entry.is_object() && i < it.value().size() )
+                    {
+                        invertShadow( entry, it.value()[ i ] );
+                    }
+                    if( !entry.is_object() )
+                    {
+                        entry = nlohmann::json::object();
+                    }
+                    fullyRead = fullyRead && entry.size() == 0;
+                }
+                if( fullyRead )
+                {
+                    toRemove.emplace_back( it.key() );
+                }
+            }
             else
             {
                 toRemove.emplace_back( it.key() );
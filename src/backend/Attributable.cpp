@@ -27,6 +27,7 @@
 #include <complex>
 #include <iostream>
 #include <set>
+#include <string>
 
 namespace openPMD
 {
@@ -68,6 +69,8 @@ AttributableImpl::deleteAttribute(std::string const& key)
         IOHandler()->enqueue(IOTask(this, aDelete));
         IOHandler()->flush();
         attri.m_attributes.erase(it);
+        attri.m_dirtyAttributes.erase(key);
+        attri.m_prefetchedAttributes.reset();
         return true;
     }
     return false;
@@ -174,6 +177,39 @@ AttributableImpl::seriesFlush( FlushLevel level )
     writable().seriesFlush( level );
 }
 
+void
+AttributableImpl::markIterationDirty()
+{
+    Writable & w = writable();
+    // do not look at the parents if the Series is gone
+    auto activeIterations = w.activeIterations.lock();
+    if( !activeIterations )
+        return;
+    if( !w.iterationResolved )
+    {
+        // the Iteration is found two levels below the Series
+        Writable * iteration = nullptr;
+        Writable * child = nullptr;
+        Writable * findSeries = &w;
+        while( findSeries->parent )
+        {
+            iteration = child;
+            child = findSeries;
+            findSeries = findSeries->parent;
+        }
+        if( !iteration || iteration->ownKeyWithinParent.size() != 1 )
+            return;
+        auto series =
+            dynamic_cast< internal::SeriesData * >( findSeries->attributable );
+        if( !series || child != &series->iterations.writable() )
+            return;
+        // the key within Series::iterations is the iteration index
+        w.iterationIndex = std::stoull( iteration->ownKeyWithinParent[ 0 ] );
+        w.iterationResolved = true;
+    }
+    activeIterations->insert( w.iterationIndex );
+}
+
 void
 AttributableImpl::flushAttributes()
 {
@@ -181,77 +217,141 @@ AttributableImpl::flushAttributes()
     {
         return;
     }
+    auto & attri = get();
     if( dirty() )
     {
         Parameter< Operation::WRITE_ATT > aWrite;
-        for( std::string const & att_name : attributes() )
-        {
+        auto enqueueWrite = [ & ]( std::string const & att_name,
+                                   Attribute const & attribute ) {
             aWrite.name = att_name;
-            aWrite.resource = getAttribute(att_name).getResource();
-            aWrite.dtype = getAttribute(att_name).dtype;
+            aWrite.resource = attribute.getResource();
+            aWrite.dtype = attribute.dtype;
             IOHandler()->enqueue(IOTask(this, aWrite));
+        };
+        /*
+         * An object that is not (yet) written in the current file needs all
+         * of its attributes, otherwise only those that have been modified
+         * since the last flush.
+         */
+        if( !written() )
+        {
+            for( auto const & entry : attri.m_attributes )
+                enqueueWrite( entry.first, entry.second );
+        }
+        else
+        {
+            for( std::string const & att_name : attri.m_dirtyAttributes )
+            {
+                auto it = attri.m_attributes.find( att_name );
+                if( it != attri.m_attributes.end() )
+                    enqueueWrite( it->first, it->second );
+            }
         }
 
         dirty() = false;
+        // the backend content changes, a later read must not see stale values
+        attri.m_prefetchedAttributes.reset();
+    }
+    attri.m_dirtyAttributes.clear();
+}
+
+Parameter< Operation::READ_ATTS > &
+AttributableImpl::prefetchAttributes()
+{
+    auto & attri = get();
+    if( !attri.m_prefetchedAttributes )
+    {
+        std::unique_ptr< Parameter< Operation::READ_ATTS > > aRead{
+            new Parameter< Operation::READ_ATTS > };
+        IOHandler()->enqueue( IOTask( this, *aRead ) );
+        IOHandler()->flush();
+        attri.m_prefetchedAttributes = std::move( aRead );
     }
+    return *attri.m_prefetchedAttributes;
+}
+
+void
+AttributableImpl::readAttribute( Parameter< Operation::READ_ATT > & aRead )
+{
+    auto & prefetched = prefetchAttributes();
+    auto it = prefetched.attributes->find( aRead.name );
+    if( it != prefetched.attributes->end() )
+    {
+        *aRead.dtype = it->second.first;
+        *aRead.resource = it->second.second;
+        return;
+    }
+    IOHandler()->enqueue( IOTask( this, aRead ) );
+    IOHandler()->flush();
+}
+
+bool
+AttributableImpl::containsAttributeInBackend( std::string const & key )
+{
+    auto & prefetched = prefetchAttributes();
+    return prefetched.attributes->count( key ) > 0 ||
+        prefetched.skipped->count( key ) > 0;
 }
 
 void
 AttributableImpl::readAttributes( ReadMode mode )
 {
     auto & attri = get();
-    Parameter< Operation::LIST_ATTS > aList;
-    IOHandler()->enqueue(IOTask(this, aList));
-    IOHandler()->flush();
+    prefetchAttributes();
+    // consume the prefetched attributes, the next parse must see fresh ones
+    std::unique_ptr< Parameter< Operation::READ_ATTS > > aRead =
+        std::move( attri.m_prefetchedAttributes );
+
+    std::vector< std::string > backend_attributes;
+    for( auto const & entry : *aRead->attributes )
+        backend_attributes.push_back( entry.first );
+    for( auto const & entry : *aRead->skipped )
+        backend_attributes.push_back( entry.first );
     std::vector< std::string > written_attributes = attributes();
 
     /* std::set_difference requires sorted ranges */
-    std::sort(aList.attributes->begin(), aList.attributes->end());
+    std::sort(backend_attributes.begin(), backend_attributes.end());
     std::sort(written_attributes.begin(), written_attributes.end());
 
     std::set< std::string > tmpAttributes;
     switch( mode )
     {
     case ReadMode::IgnoreExisting:
-        // reread: aList - written_attributes
+        // reread: backend_attributes - written_attributes
         std::set_difference(
-            aList.attributes->begin(), aList.attributes->end(),
+            backend_attributes.begin(), backend_attributes.end(),
             written_attributes.begin(), written_attributes.end(),
             std::inserter(tmpAttributes, tmpAttributes.begin()));
         break;
     case ReadMode::OverrideExisting:
         tmpAttributes = std::set< std::string >(
-            aList.attributes->begin(),
-            aList.attributes->end() );
+            backend_attributes.begin(),
+            backend_attributes.end() );
         break;
     case ReadMode::FullyReread:
         attri.m_attributes.clear();
         tmpAttributes = std::set< std::string >(
-            aList.attributes->begin(),
-            aList.attributes->end() );
+            backend_attributes.begin(),
+            backend_attributes.end() );
         break;
     }
 
     using DT = Datatype;
-    Parameter< Operation::READ_ATT > aRead;
 
     for( auto const& att_name : tmpAttributes )
     {
-        aRead.name = att_name;
         std::string att = auxiliary::strip(att_name, {'\0'});
-        IOHandler()->enqueue(IOTask(this, aRead));
-        try
-        {
-            IOHandler()->flush();
-        } catch( unsupported_data_error const& e )
+        auto skipped = aRead->skipped->find( att_name );
+        if( skipped != aRead->skipped->end() )
         {
             std::cerr << "Skipping non-standard attribute "
                       << att << " ("
-                      << e.what()
+                      << skipped->second
                       << ")\n";
             continue;
         }
-        Attribute a(*aRead.resource);
+        auto const & entry = aRead->attributes->at( att_name );
+        Attribute a( entry.second );
 
         auto guardUnitDimension =
             [ this ]( std::string const & key, auto vector )
@@ -275,7 +375,7 @@ AttributableImpl::readAttributes( ReadMode mode )
             }
         };
 
-        switch( *aRead.dtype )
+        switch( entry.first )
         {
             case DT::CHAR:
                 setAttribute(att, a.get< char >());
@@ -392,13 +492,29 @@ AttributableImpl::readAttributes( ReadMode mode )
     }
 
     dirty() = false;
+    // attributes that have just been read need not be written back
+    attri.m_dirtyAttributes.clear();
 }
 
 void
 AttributableImpl::linkHierarchy(Writable& w)
+{
+    writable().parent = &w;
+    adoptLink( w );
+}
+
+void
+AttributableImpl::adoptLink(Writable const& w)
 {
     auto handler = w.IOHandler;
     writable().IOHandler = handler;
-    writable().parent = &w;
+    writable().activeIterations = w.activeIterations;
+    writable().iterationResolved = false;
+    relinkChildren();
+}
+
+void
+AttributableImpl::relinkChildren()
+{
 }
 } // openPMD
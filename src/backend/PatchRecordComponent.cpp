@@ -46,6 +46,7 @@ PatchRecordComponent::resetDataset(Dataset d)
 
     *m_dataset = d;
     dirty() = true;
+    markIterationDirty();
     return *this;
 }
 
@@ -108,8 +109,7 @@ PatchRecordComponent::read()
     Parameter< Operation::READ_ATT > aRead;
 
     aRead.name = "unitSI";
-    IOHandler()->enqueue(IOTask(this, aRead));
-    IOHandler()->flush();
+    readAttribute( aRead );
     if( *aRead.dtype == Datatype::DOUBLE )
         setUnitSI(Attribute(*aRead.resource).get< double >());
     else
@@ -31,6 +31,8 @@ namespace openPMD
               attributable{a},
               parent{nullptr},
               dirty{true},
+              iterationIndex{0},
+              iterationResolved{false},
               written{false}
     { }
 
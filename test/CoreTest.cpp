@@ -4,6 +4,7 @@
 #   define OPENPMD_protected public
 #endif
 #include "openPMD/openPMD.hpp"
+#include "openPMD/IO/AbstractIOHandlerImpl.hpp"
 
 #include <catch2/catch.hpp>
 
@@ -11,11 +12,14 @@
 #include <string>
 #include <vector>
 #include <array>
+#include <chrono>
 #include <complex>
 #include <cstddef>
 #include <cstdint>
 #include <sstream>
 #include <iostream>
+#include <numeric>
+#include <queue>
 
 using namespace openPMD;
 
@@ -949,3 +953,156 @@ TEST_CASE( "load_chunk_wrong_datatype", "[core]" )
                 "Type conversion during chunk loading not yet implemented" ) );
     }
 }
+
+TEST_CASE( "iotask_parameter_pool", "[core]" )
+{
+    Writable * const writable = nullptr;
+    std::queue< IOTask > tasks;
+    for( int round = 0; round < 3; ++round )
+    {
+        for( int i = 0; i < 100; ++i )
+        {
+            Parameter< Operation::WRITE_ATT > aWrite;
+            aWrite.name = "attr" + std::to_string( i );
+            aWrite.dtype = Datatype::INT;
+            aWrite.resource = i;
+            tasks.emplace( writable, aWrite );
+        }
+        // recycled memory must never alias a live parameter
+        for( int i = 0; i < 100; ++i )
+        {
+            auto & param = *dynamic_cast< Parameter< Operation::WRITE_ATT > * >(
+                tasks.front().parameter.get() );
+            REQUIRE( param.name == "attr" + std::to_string( i ) );
+            REQUIRE( variantSrc::get< int >( param.resource ) == i );
+            tasks.pop();
+        }
+    }
+}
+
+TEST_CASE( "coalesce_dataset_tasks", "[core]" )
+{
+    Writable * const writable = reinterpret_cast< Writable * >( 0x1 );
+    Writable * const other = reinterpret_cast< Writable * >( 0x2 );
+    std::vector< std::shared_ptr< int > > rows;
+    std::queue< IOTask > work;
+    // four neighbouring rows of a 4x3 dataset, then one non-adjacent row
+    for( int row : { 0, 1, 2, 3, 5 } )
+    {
+        std::shared_ptr< int > data{
+            new int[ 3 ], []( int * p ) { delete[] p; } };
+        for( int col = 0; col < 3; ++col )
+            data.get()[ col ] = 10 * row + col;
+        rows.push_back( data );
+        Parameter< Operation::WRITE_DATASET > dWrite;
+        dWrite.offset = { uint64_t( row ), 0 };
+        dWrite.extent = { 1, 3 };
+        dWrite.dtype = Datatype::INT;
+        dWrite.data = data;
+        work.push( IOTask( writable, dWrite ) );
+    }
+    // same hyperslab, but another dataset
+    Parameter< Operation::WRITE_DATASET > dWrite;
+    dWrite.offset = { 6, 0 };
+    dWrite.extent = { 1, 3 };
+    dWrite.dtype = Datatype::INT;
+    dWrite.data = rows.back();
+    work.push( IOTask( other, dWrite ) );
+
+    internal::coalesceDatasetTasks( work );
+    REQUIRE( work.size() == 3 );
+    auto & merged = *dynamic_cast< Parameter< Operation::WRITE_DATASET > * >(
+        work.front().parameter.get() );
+    REQUIRE( merged.offset == Offset{ 0, 0 } );
+    REQUIRE( merged.extent == Extent{ 4, 3 } );
+    auto mergedData = static_cast< int const * >( merged.data.get() );
+    for( int i = 0; i < 12; ++i )
+        REQUIRE( mergedData[ i ] == 10 * ( i / 3 ) + i % 3 );
+    work = {};
+
+    // reads are only merged on request
+    std::vector< std::shared_ptr< int > > targets;
+    for( int col = 0; col < 4; ++col )
+    {
+        std::shared_ptr< int > data{
+            new int[ 2 ], []( int * p ) { delete[] p; } };
+        targets.push_back( data );
+        Parameter< Operation::READ_DATASET > dRead;
+        dRead.offset = { 7, uint64_t( 2 * col ) };
+        dRead.extent = { 1, 2 };
+        dRead.dtype = Datatype::INT;
+        dRead.data = data;
+        work.push( IOTask( writable, dRead ) );
+    }
+    internal::coalesceDatasetTasks( work );
+    REQUIRE( work.size() == 4 );
+
+    // merged reads are scattered back explicitly after a successful read
+    std::queue< IOTask > merge = work;
+    internal::CoalescedReads reads;
+    internal::coalesceDatasetTasks( merge, &reads );
+    REQUIRE( merge.size() == 1 );
+    REQUIRE( reads.size() == 1 );
+    auto & read = *dynamic_cast< Parameter< Operation::READ_DATASET > * >(
+        merge.front().parameter.get() );
+    REQUIRE( read.offset == Offset{ 7, 0 } );
+    REQUIRE( read.extent == Extent{ 1, 8 } );
+    auto scratch = static_cast< int * >( read.data.get() );
+    std::iota( scratch, scratch + 8, 0 );
+    // releasing the scratch buffer alone copies nothing
+    for( auto & target : targets )
+        target.get()[ 0 ] = target.get()[ 1 ] = -1;
+    merge.pop();
+    REQUIRE( targets[ 0 ].get()[ 0 ] == -1 );
+    reads.begin()->second.scatter();
+    for( int col = 0; col < 4; ++col )
+    {
+        REQUIRE( targets[ col ].get()[ 0 ] == 2 * col );
+        REQUIRE( targets[ col ].get()[ 1 ] == 2 * col + 1 );
+    }
+}
+
+TEST_CASE( "iotask_enqueue_benchmark", "[.benchmark]" )
+{
+    constexpr size_t numTasks = 1000000;
+    constexpr int rounds = 5;
+    Parameter< Operation::WRITE_ATT > aWrite;
+    aWrite.name = "unitSI";
+    aWrite.dtype = Datatype::DOUBLE;
+    aWrite.resource = 1.;
+
+    // fill a queue and drain it again, as a flush would
+    auto nanosecondsPerTask = [ & ]( auto && enqueue ) {
+        using Clock = std::chrono::steady_clock;
+        auto const start = Clock::now();
+        for( int round = 0; round < rounds; ++round )
+        {
+            for( size_t i = 0; i < numTasks; ++i )
+                enqueue();
+        }
+        auto const end = Clock::now();
+        return double( std::chrono::duration_cast< std::chrono::nanoseconds >(
+                           end - start )
+                           .count() ) /
+            double( numTasks * rounds );
+    };
+
+    std::queue< std::shared_ptr< AbstractParameter > > cloned;
+    double const withClone = nanosecondsPerTask( [ & ]() {
+        cloned.emplace( aWrite.clone() );
+        if( cloned.size() == numTasks )
+            cloned = {};
+    } );
+
+    Writable * const writable = nullptr;
+    std::queue< IOTask > pooled;
+    double const withPool = nanosecondsPerTask( [ & ]() {
+        pooled.emplace( writable, aWrite );
+        if( pooled.size() == numTasks )
+            pooled = {};
+    } );
+
+    std::cout << "[iotask_enqueue_benchmark] ns per task: clone() + "
+                 "shared_ptr: "
+              << withClone << ", pooled IOTask: " << withPool << std::endl;
+}
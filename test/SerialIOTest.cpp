@@ -4,6 +4,7 @@
 #   define OPENPMD_protected public
 #endif
 
+#include "openPMD/IO/AbstractIOHandlerHelper.hpp"
 #include "openPMD/auxiliary/Environment.hpp"
 #include "openPMD/auxiliary/Filesystem.hpp"
 #include "openPMD/auxiliary/StringManip.hpp"
@@ -12,20 +13,26 @@
 #if openPMD_HAVE_ADIOS2
 #include <adios2.h>
 #endif
+#if openPMD_HAVE_HDF5
+#include <hdf5.h>
+#endif
 #include <catch2/catch.hpp>
 
 #include <algorithm>
 #include <array>
+#include <chrono>
 #include <cmath>
 #include <complex>
 #include <fstream>
 #include <iostream>
 #include <limits>
 #include <list>
+#include <map>
 #include <memory>
 #include <numeric>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <tuple>
 #include <vector>
 
@@ -223,6 +230,49 @@ TEST_CASE( "write_and_read_many_iterations", "[serial]" )
     }
 }
 
+void
+deferred_parsing_on_access( std::string const & ext )
+{
+    std::string const filename =
+        "../samples/deferred_parsing_on_access." + ext;
+    constexpr uint64_t nIterations = 10;
+    {
+        Series write( filename, Access::CREATE );
+        for( uint64_t i = 0; i < nIterations; ++i )
+        {
+            auto E_x = write.iterations[ i ].meshes[ "E" ][ "x" ];
+            E_x.resetDataset( { Datatype::INT, { 1 } } );
+            E_x.makeConstant( int( i ) );
+        }
+    }
+
+    Series read(
+        filename, Access::READ_ONLY, "{\"defer_iteration_parsing\": true}" );
+    REQUIRE( read.iterations.size() == nIterations );
+    // nothing parsed yet
+    for( auto const & iteration : read.iterations )
+    {
+        REQUIRE( iteration.second.meshes.empty() );
+    }
+    // accessing an iteration parses it without explicit Iteration::open()
+    auto E_x = read.iterations[ 5 ].meshes[ "E" ][ "x" ];
+    REQUIRE( E_x.getExtent() == Extent{ 1 } );
+    auto chunk = E_x.loadChunk< int >( { 0 }, { 1 } );
+    read.flush();
+    REQUIRE( *chunk == 5 );
+    REQUIRE( read.iterations.at( 7 ).meshes.contains( "E" ) );
+    // other iterations stay unparsed
+    REQUIRE( read.iterations.find( 6 )->second.meshes.empty() );
+}
+
+TEST_CASE( "deferred_parsing_on_access", "[serial]" )
+{
+    for( auto const & t : testedFileExtensions() )
+    {
+        deferred_parsing_on_access( t );
+    }
+}
+
 TEST_CASE( "multi_series_test", "[serial]" )
 {
     std::list< Series > allSeries;
@@ -271,13 +321,265 @@ TEST_CASE( "multi_series_test", "[serial]" )
     allSeries.clear();
 }
 
+TEST_CASE( "json_cache", "[serial][json]" )
+{
+    constexpr uint64_t nIterations = 5;
+    constexpr unsigned rows = 4;
+    constexpr unsigned cols = 8;
+    auto checkSeries = [ & ]( std::string const & name, int extra )
+    {
+        Series read( name, Access::READ_ONLY );
+        REQUIRE( read.iterations.size() == nIterations );
+        for( auto & iteration : read.iterations )
+        {
+            auto E_x = iteration.second.meshes[ "E" ][ "x" ];
+            auto chunk = E_x.loadChunk< int >( { 0, 0 }, { rows, cols } );
+            read.flush();
+            for( unsigned i = 0; i < rows * cols; ++i )
+            {
+                REQUIRE(
+                    chunk.get()[ i ] ==
+                    int( iteration.first * 100 + i / cols ) );
+            }
+            REQUIRE(
+                iteration.second.getAttribute( "row" ).get< unsigned >() ==
+                rows - 1 );
+        }
+        REQUIRE(
+            read.iterations[ 0 ].getAttribute( "extra" ).get< int >() ==
+            extra );
+    };
+
+    for( std::string const config :
+         { "{}",
+           R"({"json": {"cache_size": 0}})",
+           R"({"json": {"cache_size": 1}})" } )
+    {
+        std::string const name = "../samples/json_cache/data_%T.json";
+        Series write( name, Access::CREATE, config );
+        for( uint64_t i = 0; i < nIterations; ++i )
+        {
+            auto iteration = write.iterations[ i ];
+            auto E_x = iteration.meshes[ "E" ][ "x" ];
+            E_x.resetDataset( { Datatype::INT, { rows, cols } } );
+            for( unsigned row = 0; row < rows; ++row )
+            {
+                std::vector< int > data( cols, int( i * 100 + row ) );
+                E_x.storeChunk( data, { row, 0 }, { 1, cols } );
+                iteration.setAttribute( "row", row );
+                write.flush();
+            }
+        }
+        // modify a file that may have been evicted in the meantime
+        write.iterations[ 0 ].setAttribute( "extra", 1 );
+        write.flush();
+        checkSeries( name, 1 );
+        write.iterations[ 0 ].setAttribute( "extra", 2 );
+        write.flush();
+        checkSeries( name, 2 );
+    }
+}
+
+TEST_CASE( "json_write_modified_files_only", "[serial][json]" )
+{
+    std::string const name = "../samples/json_modified_only/data%T.json";
+    std::vector< int > data{ 1, 2, 3, 4 };
+    {
+        Series write( name, Access::CREATE, R"({"json": {"format": "pretty"}})" );
+        for( unsigned i = 0; i < 2; ++i )
+        {
+            auto E_x = write.iterations[ i ].meshes[ "E" ][ "x" ];
+            E_x.resetDataset( { Datatype::INT, { 4 } } );
+            E_x.storeChunk( data, { 0 }, { 4 } );
+        }
+    }
+    std::string const marker = "\n\n";
+    auto contents = []( std::string const & path ) {
+        std::ifstream file( path );
+        return std::string{ std::istreambuf_iterator< char >( file ), {} };
+    };
+    for( auto const & path :
+         { "../samples/json_modified_only/data0.json",
+           "../samples/json_modified_only/data1.json" } )
+    {
+        REQUIRE( contents( path ).find( "\n  " ) != std::string::npos );
+        // mark the files, rewriting them removes the marker
+        std::ofstream file( path, std::ios_base::app );
+        file << marker;
+    }
+
+    {
+        Series readWrite( name, Access::READ_WRITE );
+        auto chunk = readWrite.iterations[ 0 ]
+                         .meshes[ "E" ][ "x" ]
+                         .loadChunk< int >( { 0 }, { 4 } );
+        readWrite.flush();
+        REQUIRE( chunk.get()[ 3 ] == 4 );
+        readWrite.iterations[ 1 ].setAttribute( "modified", 1 );
+    }
+    auto const unmodified =
+        contents( "../samples/json_modified_only/data0.json" );
+    auto const modified =
+        contents( "../samples/json_modified_only/data1.json" );
+    REQUIRE( unmodified.substr( unmodified.size() - marker.size() ) == marker );
+    REQUIRE( modified.substr( modified.size() - marker.size() ) != marker );
+    // compact by default
+    REQUIRE( modified.find( "\n  " ) == std::string::npos );
+
+    Series read( name, Access::READ_ONLY );
+    REQUIRE( read.iterations[ 1 ].getAttribute( "modified" ).get< int >() == 1 );
+}
+
+TEST_CASE( "json_concurrent_flush", "[serial][json]" )
+{
+    std::string const name = "../samples/json_concurrent_flush/data%T.json";
+    constexpr unsigned iterations = 10;
+    for( unsigned threads : { 1u, 4u } )
+    {
+        {
+            Series write(
+                name,
+                Access::CREATE,
+                R"({"json": {"flush_threads": )" + std::to_string( threads ) +
+                    "}}" );
+            std::vector< std::vector< unsigned > > data;
+            for( unsigned i = 0; i < iterations; ++i )
+            {
+                data.push_back( { i, threads } );
+            }
+            for( unsigned i = 0; i < iterations; ++i )
+            {
+                auto E_x = write.iterations[ i ].meshes[ "E" ][ "x" ];
+                E_x.resetDataset( { Datatype::UINT, { 2 } } );
+                E_x.storeChunk( data[ i ], { 0 }, { 2 } );
+            }
+            // all files are written within this flush
+            write.flush();
+        }
+
+        Series read( name, Access::READ_ONLY );
+        REQUIRE( read.iterations.size() == iterations );
+        for( unsigned i = 0; i < iterations; ++i )
+        {
+            auto chunk = read.iterations[ i ]
+                             .meshes[ "E" ][ "x" ]
+                             .loadChunk< unsigned >( { 0 }, { 2 } );
+            read.flush();
+            REQUIRE( chunk.get()[ 0 ] == i );
+            REQUIRE( chunk.get()[ 1 ] == threads );
+        }
+    }
+}
+
+TEST_CASE( "json_binary_encodings", "[serial][json]" )
+{
+    constexpr size_t length = 1000;
+    std::vector< double > data( length );
+    for( size_t i = 0; i < length; ++i )
+    {
+        data[ i ] = std::sin( double( i ) );
+    }
+    std::map< std::string, size_t > fileSizes;
+    for( std::string const ext : { "json", "cbor", "msgpack", "ubjson", "bson" } )
+    {
+        std::string const name = "../samples/json_binary_encodings." + ext;
+        {
+            Series write( name, Access::CREATE );
+            auto E_x = write.iterations[ 0 ].meshes[ "E" ][ "x" ];
+            E_x.setAttribute( "encoding", ext );
+            E_x.resetDataset( { Datatype::DOUBLE, { 10, length / 10 } } );
+            E_x.storeChunk( data, { 0, 0 }, { 10, length / 10 } );
+        }
+        {
+            std::ifstream file( name, std::ios_base::binary | std::ios_base::ate );
+            fileSizes[ ext ] = static_cast< size_t >( file.tellg() );
+        }
+
+        Series read( name, Access::READ_ONLY );
+        auto E_x = read.iterations[ 0 ].meshes[ "E" ][ "x" ];
+        REQUIRE( E_x.getAttribute( "encoding" ).get< std::string >() == ext );
+        REQUIRE( E_x.getDatatype() == Datatype::DOUBLE );
+        REQUIRE( E_x.getExtent() == Extent{ 10, length / 10 } );
+        auto chunk = E_x.loadChunk< double >( { 0, 0 }, { 10, length / 10 } );
+        read.flush();
+        for( size_t i = 0; i < length; ++i )
+        {
+            REQUIRE( chunk.get()[ i ] == data[ i ] );
+        }
+    }
+    REQUIRE( fileSizes[ "cbor" ] < fileSizes[ "json" ] );
+    REQUIRE( fileSizes[ "msgpack" ] < fileSizes[ "json" ] );
+    REQUIRE( fileSizes[ "ubjson" ] < fileSizes[ "json" ] );
+
+    // a configured encoding overrides the file ending, files are named after
+    // the encoding
+    if( auxiliary::file_exists( "../samples/json_binary_encodings_config.json" ) )
+    {
+        auxiliary::remove_file( "../samples/json_binary_encodings_config.json" );
+    }
+    {
+        Series write(
+            "../samples/json_binary_encodings_config.json",
+            Access::CREATE,
+            R"({"json": {"encoding": "cbor"}})" );
+        write.iterations[ 0 ].setAttribute( "answer", 42 );
+    }
+    REQUIRE( auxiliary::file_exists(
+        "../samples/json_binary_encodings_config.cbor" ) );
+    REQUIRE( !auxiliary::file_exists(
+        "../samples/json_binary_encodings_config.json" ) );
+    {
+        Series read(
+            "../samples/json_binary_encodings_config.json",
+            Access::READ_ONLY,
+            R"({"json": {"encoding": "cbor"}})" );
+        REQUIRE(
+            read.iterations[ 0 ].getAttribute( "answer" ).get< int >() == 42 );
+    }
+    {
+        Series read(
+            "../samples/json_binary_encodings_config.cbor",
+            Access::READ_ONLY );
+        REQUIRE(
+            read.iterations[ 0 ].getAttribute( "answer" ).get< int >() == 42 );
+    }
+
+    // file-based Series look for the files of the configured encoding
+    {
+        Series write(
+            "../samples/json_binary_encodings_config_%T.json",
+            Access::CREATE,
+            R"({"json": {"encoding": "msgpack"}})" );
+        for( uint64_t i = 0; i < 3; ++i )
+            write.iterations[ i ].setAttribute( "answer", int( i ) );
+    }
+    REQUIRE( auxiliary::file_exists(
+        "../samples/json_binary_encodings_config_2.msgpack" ) );
+    Series read(
+        "../samples/json_binary_encodings_config_%T.json",
+        Access::READ_ONLY,
+        R"({"json": {"encoding": "msgpack"}})" );
+    REQUIRE( read.iterations.size() == 3 );
+    REQUIRE(
+        read.iterations[ 2 ].getAttribute( "answer" ).get< int >() == 2 );
+
+    // unknown encodings are named in the error
+    REQUIRE_THROWS_WITH(
+        Series(
+            "../samples/json_binary_encodings_config_invalid.json",
+            Access::CREATE,
+            R"({"json": {"encoding": "yaml"}})" ),
+        Catch::Equals(
+            "[Series] Unknown JSON encoding 'yaml', expected one of json, "
+            "cbor, msgpack, ubjson, bson." ) );
+}
+
 TEST_CASE( "available_chunks_test_json", "[serial][json]" )
 {
     /*
      * This test is JSON specific
-     * Our JSON backend does not store chunks explicitly,
-     * so the JSON backend will simply go through the multidimensional array
-     * and gather the data items into chunks
+     * Our JSON backend records the written chunks in a chunk table per
+     * dataset and returns them as they were written.
      * Example dataset:
      *
      *      0123
@@ -292,15 +594,14 @@ TEST_CASE( "available_chunks_test_json", "[serial][json]" )
      *    8 **_*
      *    9 ___*
      *
-     * Will be read as three chunks:
+     * Let's write the first chunk in the above depiction line by line,
+     * flushing each line so that the lines are not merged into one write.
+     * For datasets without a chunk table, as written by older versions, the
+     * JSON backend will go through the multidimensional array and gather the
+     * data items into chunks, reading the above as three chunks:
      * 1. (2,0) -- (5,4) (offset -- extent)
      * 2. (7,0) -- (2,2) (offset -- extent)
      * 3. (8,3) -- (2,1) (offset -- extent)
-     *
-     * Since the chunks are reconstructed, they won't necessarily
-     * correspond with the way that the chunks were written.
-     * As an example, let's write the first chunk in the above depiction
-     * line by line.
      */
     constexpr unsigned height = 10;
     std::string name = "../samples/available_chunks.json";
@@ -314,12 +615,16 @@ TEST_CASE( "available_chunks_test_json", "[serial][json]" )
         for( unsigned line = 2; line < 7; ++line )
         {
             E_x.storeChunk( data, { line, 0 }, { 1, 4 } );
+            write.flush();
         }
         for( unsigned line = 7; line < 9; ++line )
         {
             E_x.storeChunk( data, { line, 0 }, { 1, 2 } );
         }
         E_x.storeChunk( data, { 8, 3 }, { 2, 1 } );
+        write.flush();
+        // writing a chunk again does not add it to the table twice
+        E_x.storeChunk( data, { 8, 3 }, { 2, 1 } );
 
         auto E_y = it0.meshes[ "E" ][ "y" ];
         E_y.resetDataset( { Datatype::INT, { height, 4 } } );
@@ -333,20 +638,375 @@ TEST_CASE( "available_chunks_test_json", "[serial][json]" )
         Iteration it0 = read.iterations[ 0 ];
         auto E_x = it0.meshes[ "E" ][ "x" ];
         ChunkTable table = E_x.availableChunks();
-        REQUIRE( table.size() == 3 );
+        REQUIRE( table.size() == 7 );
         /*
          * Explicitly convert things to bool, so Catch doesn't get the splendid
          * idea to print the Chunk struct.
          */
+        for( unsigned line = 2; line < 7; ++line )
+        {
+            REQUIRE( bool(
+                table[ line - 2 ] ==
+                WrittenChunkInfo( { line, 0 }, { 1, 4 }, 0 ) ) );
+        }
+        REQUIRE( bool( table[ 5 ] == WrittenChunkInfo( { 7, 0 }, { 2, 2 } ) ) );
+        REQUIRE( bool( table[ 6 ] == WrittenChunkInfo( { 8, 3 }, { 2, 1 } ) ) );
+
+        auto E_y = it0.meshes[ "E" ][ "y" ];
+        table = E_y.availableChunks();
+        REQUIRE( table.size() == 1 );
+        REQUIRE(
+            bool( table[ 0 ] == WrittenChunkInfo( { 0, 0 }, { height, 4 } ) ) );
+    }
+
+    // remove the chunk table, as in files written by older versions
+    std::string contents;
+    {
+        std::ifstream file( name );
+        contents.assign( std::istreambuf_iterator< char >( file ), {} );
+    }
+    std::string const key = "\"chunks\":[";
+    auto begin = contents.find( key );
+    REQUIRE( begin != std::string::npos );
+    auto end = begin + key.size();
+    for( int depth = 1; depth > 0; ++end )
+    {
+        depth += contents[ end ] == '[' ? 1 : contents[ end ] == ']' ? -1 : 0;
+    }
+    // keys are sorted, "data" follows
+    contents.erase( begin, end + 1 - begin );
+    {
+        std::ofstream file( name );
+        file << contents;
+    }
+
+    {
+        Series read( name, Access::READ_ONLY );
+        auto E_x = read.iterations[ 0 ].meshes[ "E" ][ "x" ];
+        ChunkTable table = E_x.availableChunks();
+        REQUIRE( table.size() == 3 );
         REQUIRE( bool( table[ 0 ] == WrittenChunkInfo( { 2, 0 }, { 5, 4 } ) ) );
         REQUIRE( bool( table[ 1 ] == WrittenChunkInfo( { 7, 0 }, { 2, 2 } ) ) );
         REQUIRE( bool( table[ 2 ] == WrittenChunkInfo( { 8, 3 }, { 2, 1 } ) ) );
+    }
+}
+
+TEST_CASE( "json_flat_layout", "[serial][json]" )
+{
+    std::string const name = "../samples/json_flat_layout.json";
+    std::vector< int > data( 2 * 3 * 4 );
+    std::iota( data.begin(), data.end(), 0 );
+    {
+        Series write(
+            name, Access::CREATE, R"({"json": {"dataset": {"layout": "flat"}}})" );
+        Iteration it0 = write.iterations[ 0 ];
+        auto E_x = it0.meshes[ "E" ][ "x" ];
+        E_x.resetDataset( { Datatype::INT, { 4, 3, 4 } } );
+        // leave out the first slab, write the rest in two hyperslabs
+        E_x.storeChunk( data, { 1, 0, 0 }, { 2, 3, 4 } );
+        E_x.storeChunk( data, { 3, 1, 0 }, { 1, 2, 4 } );
 
         auto E_y = it0.meshes[ "E" ][ "y" ];
-        table = E_y.availableChunks();
+        E_y.resetDataset( { Datatype::CDOUBLE, { 2 } } );
+        std::vector< std::complex< double > > complexData{ { 1., 2. },
+                                                           { 3., 4. } };
+        E_y.storeChunk( complexData, { 0 }, { 2 } );
+
+        // per-dataset configuration overrides the global one
+        auto E_z = it0.meshes[ "E" ][ "z" ];
+        E_z.resetDataset( { Datatype::INT,
+                            { 2, 3 },
+                            R"({"json": {"dataset": {"layout": "nested"}}})" } );
+        E_z.storeChunk( data, { 0, 0 }, { 2, 3 } );
+        write.flush();
+
+        // resizing keeps the previously written rows in place
+        E_x.resetDataset( { Datatype::INT, { 5, 3, 5 } } );
+        E_x.storeChunk( data, { 4, 0, 4 }, { 1, 3, 1 } );
+    }
+    {
+        std::ifstream file( name );
+        std::string contents{ std::istreambuf_iterator< char >( file ), {} };
+        REQUIRE( contents.find( "\"extent\"" ) != std::string::npos );
+    }
+
+    Series read( name, Access::READ_ONLY );
+    Iteration it0 = read.iterations[ 0 ];
+    auto E_x = it0.meshes[ "E" ][ "x" ];
+    REQUIRE( E_x.getExtent() == Extent{ 5, 3, 5 } );
+    auto slab = E_x.loadChunk< int >( { 1, 1, 1 }, { 2, 2, 3 } );
+    auto lastRow = E_x.loadChunk< int >( { 3, 1, 0 }, { 1, 2, 4 } );
+    auto appended = E_x.loadChunk< int >( { 4, 0, 4 }, { 1, 3, 1 } );
+    auto E_y = it0.meshes[ "E" ][ "y" ];
+    auto complexChunk = E_y.loadChunk< std::complex< double > >( { 0 }, { 2 } );
+    auto E_z = it0.meshes[ "E" ][ "z" ];
+    REQUIRE( E_z.getExtent() == Extent{ 2, 3 } );
+    auto nested = E_z.loadChunk< int >( { 0, 0 }, { 2, 3 } );
+    read.flush();
+
+    for( size_t i = 0; i < 2; ++i )
+    {
+        for( size_t j = 0; j < 2; ++j )
+        {
+            for( size_t k = 0; k < 3; ++k )
+            {
+                REQUIRE(
+                    slab.get()[ i * 6 + j * 3 + k ] ==
+                    data[ i * 12 + ( j + 1 ) * 4 + k + 1 ] );
+            }
+        }
+    }
+    for( size_t i = 0; i < 8; ++i )
+    {
+        REQUIRE( lastRow.get()[ i ] == data[ i ] );
+    }
+    for( size_t i = 0; i < 3; ++i )
+    {
+        REQUIRE( appended.get()[ i ] == data[ i ] );
+    }
+    REQUIRE( complexChunk.get()[ 0 ] == std::complex< double >( 1., 2. ) );
+    REQUIRE( complexChunk.get()[ 1 ] == std::complex< double >( 3., 4. ) );
+    for( size_t i = 0; i < 6; ++i )
+    {
+        REQUIRE( nested.get()[ i ] == data[ i ] );
+    }
+
+    ChunkTable table = E_x.availableChunks();
+    REQUIRE( table.size() == 3 );
+    REQUIRE( bool( table[ 0 ] == WrittenChunkInfo( { 1, 0, 0 }, { 2, 3, 4 } ) ) );
+    REQUIRE( bool( table[ 1 ] == WrittenChunkInfo( { 3, 1, 0 }, { 1, 2, 4 } ) ) );
+    REQUIRE( bool( table[ 2 ] == WrittenChunkInfo( { 4, 0, 4 }, { 1, 3, 1 } ) ) );
+    table = E_y.availableChunks();
+    REQUIRE( table.size() == 1 );
+    REQUIRE( bool( table[ 0 ] == WrittenChunkInfo( { 0 }, { 2 } ) ) );
+
+    REQUIRE_THROWS( Series(
+        "../samples/json_flat_layout_invalid.json",
+        Access::CREATE,
+        R"({"json": {"dataset": {"layout": "diagonal"}}})" ) );
+}
+
+TEST_CASE( "json_base64_layout", "[serial][json]" )
+{
+    std::string const name = "../samples/json_base64_layout.json";
+    constexpr size_t length = 1000;
+    std::vector< double > data( length );
+    for( size_t i = 0; i < length; ++i )
+    {
+        data[ i ] = std::sin( double( i ) );
+    }
+    std::vector< short > shorts{ 1, -2, 3, -4, 5, -6, 7 };
+    std::vector< std::complex< double > > complexData{ { 1., -1. },
+                                                       { 0.5, 2. } };
+    size_t nestedSize;
+    {
+        Series write(
+            "../samples/json_base64_layout_nested.json", Access::CREATE );
+        auto E_x = write.iterations[ 0 ].meshes[ "E" ][ "x" ];
+        E_x.resetDataset( { Datatype::DOUBLE, { 10, length / 10 } } );
+        E_x.storeChunk( data, { 0, 0 }, { 10, length / 10 } );
+        write.flush();
+        std::ifstream file(
+            "../samples/json_base64_layout_nested.json",
+            std::ios_base::binary | std::ios_base::ate );
+        nestedSize = static_cast< size_t >( file.tellg() );
+    }
+    {
+        Series write(
+            name,
+            Access::CREATE,
+            R"({"json": {"dataset": {"layout": "base64"}}})" );
+        Iteration it0 = write.iterations[ 0 ];
+        auto E_x = it0.meshes[ "E" ][ "x" ];
+        E_x.resetDataset( { Datatype::DOUBLE, { 10, length / 10 } } );
+        E_x.storeChunk( data, { 0, 0 }, { 10, length / 10 } );
+        // odd byte offsets, so that rows do not align with base64 groups
+        auto B_x = it0.meshes[ "B" ][ "x" ];
+        B_x.resetDataset( { Datatype::SHORT, { 3, 5 } } );
+        B_x.storeChunk( shorts, { 0, 1 }, { 1, 3 } );
+        B_x.storeChunk( shorts, { 1, 3 }, { 2, 2 } );
+        auto B_y = it0.meshes[ "B" ][ "y" ];
+        B_y.resetDataset( { Datatype::CDOUBLE, { 2 } } );
+        B_y.storeChunk( complexData, { 0 }, { 2 } );
+        write.flush();
+
+        B_x.resetDataset( { Datatype::SHORT, { 4, 7 } } );
+        B_x.storeChunk( shorts, { 3, 0 }, { 1, 7 } );
+    }
+    {
+        std::ifstream file( name, std::ios_base::binary | std::ios_base::ate );
+        REQUIRE( 3 * static_cast< size_t >( file.tellg() ) < 2 * nestedSize );
+    }
+
+    Series read( name, Access::READ_ONLY );
+    Iteration it0 = read.iterations[ 0 ];
+    auto E_x = it0.meshes[ "E" ][ "x" ];
+    auto B_x = it0.meshes[ "B" ][ "x" ];
+    auto B_y = it0.meshes[ "B" ][ "y" ];
+    REQUIRE( E_x.getExtent() == Extent{ 10, length / 10 } );
+    REQUIRE( B_x.getExtent() == Extent{ 4, 7 } );
+    REQUIRE( B_y.getExtent() == Extent{ 2 } );
+    auto chunkX = E_x.loadChunk< double >( { 3, 7 }, { 2, 5 } );
+    auto shortChunk = B_x.loadChunk< short >( { 0, 0 }, { 4, 7 } );
+    auto complexChunk = B_y.loadChunk< std::complex< double > >( { 0 }, { 2 } );
+    read.flush();
+
+    for( size_t i = 0; i < 2; ++i )
+    {
+        for( size_t j = 0; j < 5; ++j )
+        {
+            REQUIRE(
+                chunkX.get()[ i * 5 + j ] ==
+                data[ ( i + 3 ) * length / 10 + j + 7 ] );
+        }
+    }
+    std::vector< short > expected{ 0,  1, -2, 3, 0, 0,  0, //
+                                   0,  0, 0,  1, -2, 0, 0, //
+                                   0,  0, 0,  3, -4, 0, 0, //
+                                   1, -2, 3, -4, 5, -6, 7 };
+    for( size_t i = 0; i < expected.size(); ++i )
+    {
+        REQUIRE( shortChunk.get()[ i ] == expected[ i ] );
+    }
+    REQUIRE( complexChunk.get()[ 0 ] == complexData[ 0 ] );
+    REQUIRE( complexChunk.get()[ 1 ] == complexData[ 1 ] );
+
+    ChunkTable table = B_x.availableChunks();
+    REQUIRE( table.size() == 3 );
+    REQUIRE( bool( table[ 0 ] == WrittenChunkInfo( { 0, 1 }, { 1, 3 } ) ) );
+    REQUIRE( bool( table[ 1 ] == WrittenChunkInfo( { 1, 3 }, { 2, 2 } ) ) );
+    REQUIRE( bool( table[ 2 ] == WrittenChunkInfo( { 3, 0 }, { 1, 7 } ) ) );
+}
+
+TEST_CASE( "json_deferred_datasets", "[serial][json]" )
+{
+    std::string const name = "../samples/json_deferred_datasets.json";
+    constexpr size_t length = 1000;
+    std::vector< double > data( length );
+    for( size_t i = 0; i < length; ++i )
+    {
+        data[ i ] = std::sin( double( i ) );
+    }
+    std::vector< std::complex< float > > complexData{ { 1.f, -1.f },
+                                                      { 0.5f, 2.f } };
+    {
+        Series write( name, Access::CREATE );
+        Iteration it0 = write.iterations[ 0 ];
+        auto E_x = it0.meshes[ "E" ][ "x" ];
+        E_x.resetDataset( { Datatype::DOUBLE, { 10, 2, length / 20 } } );
+        E_x.storeChunk( data, { 0, 0, 0 }, { 10, 2, length / 20 } );
+        E_x.setAttribute( "comment", std::string( "data: [1, \"]\"]" ) );
+        auto E_y = it0.meshes[ "E" ][ "y" ];
+        E_y.resetDataset( { Datatype::CFLOAT, { 2 } } );
+        E_y.storeChunk( complexData, { 0 }, { 2 } );
+        auto E_z = it0.meshes[ "E" ][ "z" ];
+        E_z.resetDataset( { Datatype::DOUBLE,
+                            { 2, length / 2 },
+                            R"({"json": {"dataset": {"layout": "flat"}}})" } );
+        E_z.storeChunk( data, { 0, 0 }, { 1, length / 2 } );
+        auto B_x = it0.meshes[ "B" ][ "x" ];
+        B_x.resetDataset( { Datatype::INT, { 0 } } );
+    }
+
+    for( std::string const config :
+         { "{}",
+           R"({"json": {"defer_dataset_parsing": false}})",
+           R"({"json": {"mmap": false}})",
+           R"({"json": {"defer_dataset_parsing": false, "mmap": false}})" } )
+    {
+        Series read( name, Access::READ_ONLY, config );
+        Iteration it0 = read.iterations[ 0 ];
+        auto E_x = it0.meshes[ "E" ][ "x" ];
+        auto E_y = it0.meshes[ "E" ][ "y" ];
+        auto E_z = it0.meshes[ "E" ][ "z" ];
+        REQUIRE( E_x.getExtent() == Extent{ 10, 2, length / 20 } );
+        REQUIRE(
+            E_x.getAttribute( "comment" ).get< std::string >() ==
+            "data: [1, \"]\"]" );
+        REQUIRE( E_y.getExtent() == Extent{ 2 } );
+        REQUIRE( E_z.getExtent() == Extent{ 2, length / 2 } );
+        REQUIRE( it0.meshes[ "B" ][ "x" ].getExtent() == Extent{ 0 } );
+
+        ChunkTable table = E_z.availableChunks();
         REQUIRE( table.size() == 1 );
         REQUIRE(
-            bool( table[ 0 ] == WrittenChunkInfo( { 0, 0 }, { height, 4 } ) ) );
+            bool( table[ 0 ] == WrittenChunkInfo( { 0, 0 }, { 1, length / 2 } ) ) );
+
+        auto chunkX = E_x.loadChunk< double >( { 5, 1, 0 }, { 1, 1, length / 20 } );
+        auto chunkY = E_y.loadChunk< std::complex< float > >( { 0 }, { 2 } );
+        auto chunkZ = E_z.loadChunk< double >( { 0, 0 }, { 1, length / 2 } );
+        read.flush();
+        for( size_t i = 0; i < length / 20; ++i )
+        {
+            REQUIRE( chunkX.get()[ i ] == data[ 11 * length / 20 + i ] );
+        }
+        REQUIRE( chunkY.get()[ 0 ] == complexData[ 0 ] );
+        REQUIRE( chunkY.get()[ 1 ] == complexData[ 1 ] );
+        for( size_t i = 0; i < length / 2; ++i )
+        {
+            REQUIRE( chunkZ.get()[ i ] == data[ i ] );
+        }
+    }
+}
+
+TEST_CASE( "json_deferred_datasets_ragged", "[serial][json]" )
+{
+    std::string const name = "../samples/json_deferred_datasets_ragged.json";
+    {
+        std::vector< int > data{ 1, 2, 3, 4, 5, 6 };
+        Series write( name, Access::CREATE );
+        auto E = write.iterations[ 0 ].meshes[ "E" ];
+        for( auto const & component : { "x", "y" } )
+        {
+            E[ component ].resetDataset( { Datatype::INT, { 2, 3 } } );
+            E[ component ].storeChunk( data, { 0, 0 }, { 2, 3 } );
+        }
+    }
+    // make the datasets ragged, x with a short row, y with a scalar row
+    std::string content;
+    {
+        std::ifstream in( name );
+        content.assign(
+            std::istreambuf_iterator< char >( in ),
+            std::istreambuf_iterator< char >() );
+    }
+    std::string const rectangular = "[[1,2,3],[4,5,6]]";
+    auto first = content.find( rectangular );
+    REQUIRE( first != std::string::npos );
+    content.replace( first, rectangular.size(), "[[1,2,3],[4,5]]" );
+    auto second = content.find( rectangular );
+    REQUIRE( second != std::string::npos );
+    content.replace( second, rectangular.size(), "[[1,2,3],4]" );
+    {
+        std::ofstream out( name, std::ios_base::trunc );
+        out << content;
+    }
+
+    // deferred parsing falls back to parsing the ragged data eagerly
+    std::vector< Extent > extents;
+    for( std::string const config :
+         { "{}",
+           R"({"json": {"mmap": false}})",
+           R"({"json": {"defer_dataset_parsing": false}})" } )
+    {
+        Series read( name, Access::READ_ONLY, config );
+        auto E = read.iterations[ 0 ].meshes[ "E" ];
+        extents.push_back( E[ "x" ].getExtent() );
+        extents.push_back( E[ "y" ].getExtent() );
+    }
+    for( auto const & extent : extents )
+    {
+        REQUIRE( extent == Extent{ 2, 3 } );
+    }
+
+    // truncated files are reported by the parser
+    {
+        std::ofstream out( name, std::ios_base::trunc );
+        out << content.substr( 0, content.find( "[[1,2,3]" ) + 5 );
+    }
+    for( std::string const config : { "{}", R"({"json": {"mmap": false}})" } )
+    {
+        REQUIRE_THROWS( Series( name, Access::READ_ONLY, config ) );
     }
 }
 
@@ -972,8 +1632,13 @@ TEST_CASE( "particle_patches", "[serial]" )
 inline
 void dtype_test( const std::string & backend )
 {
-    bool test_long_double = (backend != "json") || sizeof (long double) <= 8;
-    bool test_long_long = (backend != "json") || sizeof (long long) <= 8;
+    // the JSON backend (in all its encodings) is limited to 64 bit numbers
+    auto const format = determineFormat("test." + backend);
+    bool const json = format == Format::JSON || format == Format::JSON_CBOR ||
+        format == Format::JSON_MSGPACK || format == Format::JSON_UBJSON ||
+        format == Format::JSON_BSON;
+    bool test_long_double = !json || sizeof (long double) <= 8;
+    bool test_long_long = !json || sizeof (long long) <= 8;
     {
         Series s = Series("../samples/dtype_test." + backend, Access::CREATE);
 
@@ -1913,50 +2578,585 @@ TEST_CASE( "empty_alternate_fbpic", "[serial][hdf5]" )
     }
 }
 
-TEST_CASE( "available_chunks_test_hdf5", "[serial][json]" )
+TEST_CASE( "available_chunks_test_hdf5", "[serial][json]" )
+{
+    /*
+     * This test is HDF5 specific
+     * For chunked datasets, HDF5 reports the chunks that have been allocated
+     * in the file, i.e. all chunks touched by a write.
+     * Datasets without chunking are returned as one large chunk.
+     */
+    constexpr unsigned height = 10;
+    std::string name = "../samples/available_chunks.h5";
+
+    std::vector< int > data{ 2, 4, 6, 8 };
+    {
+        Series write( name, Access::CREATE );
+        Iteration it0 = write.iterations[ 0 ];
+        auto E = it0.meshes[ "E" ];
+        Dataset rows{ Datatype::INT, { height, 4 } };
+        rows.options = R"({"hdf5": {"dataset": {"chunks": [1, 4]}}})";
+        Dataset contiguous{ Datatype::INT, { height, 4 } };
+        contiguous.options = R"({"hdf5": {"dataset": {"chunks": "none"}}})";
+        E[ "x" ].resetDataset( rows );
+        E[ "y" ].resetDataset( contiguous );
+        // sparsely written
+        Dataset sparse{ Datatype::INT, { 100, 100 } };
+        sparse.options = R"({"hdf5": {"dataset": {"chunks": [1, 1]}}})";
+        E[ "z" ].resetDataset( sparse );
+        E[ "z" ].storeChunk( data, { 50, 50 }, { 1, 2 } );
+        for( auto component : { "x", "y" } )
+        {
+            auto E_i = E[ component ];
+            for( unsigned line = 2; line < 7; ++line )
+            {
+                E_i.storeChunk( data, { line, 0 }, { 1, 4 } );
+            }
+            for( unsigned line = 7; line < 9; ++line )
+            {
+                E_i.storeChunk( data, { line, 0 }, { 1, 2 } );
+            }
+            E_i.storeChunk( data, { 8, 3 }, {2, 1 } );
+        }
+        it0.close();
+    }
+
+    {
+        Series read( name, Access::READ_ONLY );
+        Iteration it0 = read.iterations[ 0 ];
+        auto E_x = it0.meshes[ "E" ][ "x" ];
+        ChunkTable table = E_x.availableChunks();
+#if H5_VERSION_GE(1,10,5)
+        // rows 2 to 9 have been written to, one chunk per row
+        REQUIRE( table.size() == 8 );
+        std::sort(
+            table.begin(),
+            table.end(),
+            []( WrittenChunkInfo const & left,
+                WrittenChunkInfo const & right )
+            { return left.offset < right.offset; } );
+        for( unsigned i = 0; i < 8; ++i )
+        {
+            REQUIRE( bool(
+                table[ i ] == WrittenChunkInfo( { i + 2, 0 }, { 1, 4 } ) ) );
+        }
+
+        table = it0.meshes[ "E" ][ "z" ].availableChunks();
+        REQUIRE( table.size() == 2 );
+        REQUIRE( bool(
+            table[ 0 ] == WrittenChunkInfo( { 50, 50 }, { 1, 1 } ) ) );
+        REQUIRE( bool(
+            table[ 1 ] == WrittenChunkInfo( { 50, 51 }, { 1, 1 } ) ) );
+#else
+        // chunks cannot be enumerated, the whole dataset is returned
+        REQUIRE( table.size() == 1 );
+        REQUIRE(
+            bool( table[ 0 ] == WrittenChunkInfo( { 0, 0 }, { height, 4 } ) ) );
+#endif
+
+        auto E_y = it0.meshes[ "E" ][ "y" ];
+        table = E_y.availableChunks();
+        REQUIRE( table.size() == 1 );
+        /*
+         * Explicitly convert things to bool, so Catch doesn't get the splendid
+         * idea to print the Chunk struct.
+         */
+        REQUIRE(
+            bool( table[ 0 ] == WrittenChunkInfo( { 0, 0 }, { height, 4 } ) ) );
+    }
+}
+
+TEST_CASE( "hdf5_handle_cache", "[serial][hdf5]" )
+{
+    constexpr unsigned rows = 10;
+    constexpr unsigned cols = 4;
+    for( std::string const config :
+         { "{}",
+           R"({"hdf5": {"handle_cache_size": 0}})",
+           R"({"hdf5": {"handle_cache_size": 2}})" } )
+    {
+        std::string const name = "../samples/hdf5_handle_cache/data%T.h5";
+        {
+            Series write( name, Access::CREATE, config );
+            for( unsigned i = 0; i < 2; ++i )
+            {
+                auto iteration = write.iterations[ i ];
+                for( auto const & component : { "x", "y", "z" } )
+                {
+                    iteration.meshes[ "E" ][ component ].resetDataset(
+                        { Datatype::INT, { rows, cols } } );
+                }
+                // interleave the writes to the datasets, one row per flush
+                for( unsigned row = 0; row < rows; ++row )
+                {
+                    // the buffers must live until flushed
+                    std::vector< std::vector< int > > data;
+                    data.reserve( 3 );
+                    for( auto const & component : { "x", "y", "z" } )
+                    {
+                        data.emplace_back(
+                            cols, int( i * 1000 + row * 10 + *component - 'x' ) );
+                        iteration.meshes[ "E" ][ component ].storeChunk(
+                            data.back(), { row, 0 }, { 1, cols } );
+                    }
+                    iteration.setAttribute( "row", row );
+                    write.flush();
+                }
+                iteration.close();
+            }
+        }
+
+        {
+            // deleting an object invalidates the cached handles
+            Series readWrite( name, Access::READ_WRITE, config );
+            auto E = readWrite.iterations[ 1 ].meshes[ "E" ];
+            auto chunk = E[ "y" ].loadChunk< int >( { 0, 0 }, { 1, cols } );
+            readWrite.flush();
+            REQUIRE( chunk.get()[ 0 ] == 1001 );
+            E.erase( "y" );
+            readWrite.flush();
+            std::vector< int > data( 2, -1 );
+            E[ "y" ].resetDataset( { Datatype::INT, { 2 } } );
+            E[ "y" ].storeChunk( data, { 0 }, { 2 } );
+            readWrite.flush();
+        }
+
+        Series read( name, Access::READ_ONLY, config );
+        for( auto & iteration : read.iterations )
+        {
+            auto E = iteration.second.meshes[ "E" ];
+            uint64_t opens = 0;
+            for( unsigned row = 0; row < rows; ++row )
+            {
+                for( auto const & component : { "x", "z" } )
+                {
+                    auto chunk = E[ component ].loadChunk< int >(
+                        { row, 1 }, { 1, 1 } );
+                    read.flush();
+                    REQUIRE(
+                        *chunk ==
+                        int( iteration.first * 1000 + row * 10 +
+                             *component - 'x' ) );
+                }
+                // the datasets stay open across flushes
+                auto const opened =
+                    read.ioStatistics().counter( "hdf5.handle_opens" );
+                if( row > 0 && config == "{}" )
+                    REQUIRE( opened == opens );
+                opens = opened;
+            }
+            REQUIRE(
+                iteration.second.getAttribute( "row" ).get< unsigned >() ==
+                rows - 1 );
+        }
+        auto y = read.iterations[ 1 ].meshes[ "E" ][ "y" ];
+        REQUIRE( y.getExtent() == Extent{ 2 } );
+        auto chunk = y.loadChunk< int >();
+        read.flush();
+        REQUIRE( chunk.get()[ 1 ] == -1 );
+    }
+}
+
+namespace openPMD
+{
+namespace test
+{
+struct TestHelper
+{
+    static std::unique_ptr< Writable > writable( Writable * parent )
+    {
+        std::unique_ptr< Writable > res{ new Writable( nullptr ) };
+        res->parent = parent;
+        return res;
+    }
+
+    static void linkHierarchy( Attributable & a, Attributable & parent )
+    {
+        a.linkHierarchy( parent.writable() );
+    }
+};
+} // test
+} // openPMD
+
+TEST_CASE( "hdf5_recreate_parent_path", "[serial][hdf5]" )
+{
+    using test::TestHelper;
+    auto handler = createIOHandler(
+        "../samples/hdf5_recreate_parent_path/", Access::CREATE, Format::HDF5 );
+    auto file = TestHelper::writable( nullptr );
+    auto a = TestHelper::writable( file.get() );
+    auto b = TestHelper::writable( file.get() );
+    auto child = TestHelper::writable( a.get() );
+    auto other = TestHelper::writable( b.get() );
+
+    Parameter< Operation::CREATE_FILE > fCreate;
+    fCreate.name = "data";
+    handler->enqueue( IOTask( file.get(), fCreate ) );
+    Parameter< Operation::CREATE_PATH > pCreate;
+    pCreate.path = "a";
+    handler->enqueue( IOTask( a.get(), pCreate ) );
+    pCreate.path = "b";
+    handler->enqueue( IOTask( b.get(), pCreate ) );
+    pCreate.path = "c";
+    handler->enqueue( IOTask( child.get(), pCreate ) );
+    handler->enqueue( IOTask( other.get(), pCreate ) );
+    Parameter< Operation::WRITE_ATT > aWrite;
+    aWrite.name = "value";
+    aWrite.dtype = Datatype::INT;
+    aWrite.resource = 1;
+    handler->enqueue( IOTask( child.get(), aWrite ) );
+    aWrite.resource = 2;
+    handler->enqueue( IOTask( other.get(), aWrite ) );
+    handler->flush();
+
+    auto readValue = [ &handler ]( Writable * writable ) {
+        Parameter< Operation::READ_ATT > aRead;
+        aRead.name = "value";
+        handler->enqueue( IOTask( writable, aRead ) );
+        handler->flush();
+        return variantSrc::get< int >( *aRead.resource );
+    };
+    // resolves and caches the path /a/c/
+    REQUIRE( readValue( child.get() ) == 1 );
+
+    // recreate the parent of child at /b/, child now refers to /b/c/
+    Parameter< Operation::DELETE_PATH > pDelete;
+    pDelete.path = ".";
+    handler->enqueue( IOTask( a.get(), pDelete ) );
+    pCreate.path = "b";
+    handler->enqueue( IOTask( a.get(), pCreate ) );
+    handler->flush();
+    REQUIRE( readValue( child.get() ) == 2 );
+}
+
+TEST_CASE( "hdf5_attribute_write_benchmark", "[.benchmark]" )
+{
+    constexpr unsigned numComponents = 1000;
+    constexpr unsigned numAttributes = 100;
+    using Clock = std::chrono::steady_clock;
+    Series series(
+        "../samples/hdf5_attribute_write_benchmark.h5", Access::CREATE );
+    auto E = series.iterations[ 0 ].meshes[ "E" ];
+    for( unsigned c = 0; c < numComponents; ++c )
+    {
+        auto component = E[ "c" + std::to_string( c ) ];
+        component.resetDataset( { Datatype::DOUBLE, { 1 } } );
+        component.makeConstant( 1. );
+        for( unsigned a = 0; a < numAttributes; ++a )
+            component.setAttribute( "attr" + std::to_string( a ), a );
+    }
+
+    auto const start = Clock::now();
+    series.flush();
+    auto const end = Clock::now();
+    std::cout << "[hdf5_attribute_write_benchmark] ms to write "
+              << numComponents * numAttributes << " attributes: "
+              << std::chrono::duration_cast< std::chrono::milliseconds >(
+                     end - start )
+                     .count()
+              << std::endl;
+}
+
+TEST_CASE( "hdf5_chunk_size", "[serial][hdf5]" )
+{
+    std::string const name = "../samples/hdf5_chunk_size.h5";
+    std::vector< int > data( 40 );
+    std::iota( data.begin(), data.end(), 0 );
+    {
+        // chunking disabled globally, only the explicitly chunked datasets
+        // can be extended
+        Series write(
+            name,
+            Access::CREATE,
+            R"({"hdf5": {"dataset": {"chunks": "none"}}})" );
+        Iteration it0 = write.iterations[ 0 ];
+        auto E_x = it0.meshes[ "E" ][ "x" ];
+        Dataset dsX( Datatype::INT, { 10, 4 }, R"({"resizable": true})" );
+        dsX.setChunkSize( { 2, 4 } );
+        E_x.resetDataset( dsX );
+        E_x.storeChunk( data, { 0, 0 }, { 10, 4 } );
+
+        auto E_y = it0.meshes[ "E" ][ "y" ];
+        E_y.resetDataset(
+            { Datatype::INT,
+              { 10, 4 },
+              R"({"resizable": true, "hdf5": {"dataset": {"chunks": [5, 1]}}})" } );
+        E_y.storeChunk( data, { 0, 0 }, { 10, 4 } );
+        write.flush();
+
+        E_x.resetDataset( { { 20, 4 } } );
+        E_x.storeChunk( data, { 10, 0 }, { 10, 4 } );
+        E_y.resetDataset( { { 10, 8 } } );
+        E_y.storeChunk( data, { 0, 4 }, { 10, 4 } );
+        write.flush();
+    }
+
+    {
+        Series read( name, Access::READ_ONLY );
+        auto E = read.iterations[ 0 ].meshes[ "E" ];
+        REQUIRE( E[ "x" ].getExtent() == Extent{ 20, 4 } );
+        REQUIRE( E[ "y" ].getExtent() == Extent{ 10, 8 } );
+        auto chunkX = E[ "x" ].loadChunk< int >();
+        auto chunkY = E[ "y" ].loadChunk< int >();
+        read.flush();
+        for( size_t i = 0; i < 80; ++i )
+        {
+            REQUIRE( chunkX.get()[ i ] == data[ i % 40 ] );
+            REQUIRE( chunkY.get()[ i ] == data[ i / 8 * 4 + i % 4 ] );
+        }
+    }
+
+    for( std::string const chunks : { "[1]", "[0, 4]", "[11, 4]", "\"big\"" } )
+    {
+        Series write( name, Access::CREATE );
+        auto E_x = write.iterations[ 0 ].meshes[ "E" ][ "x" ];
+        E_x.resetDataset(
+            { Datatype::INT,
+              { 10, 4 },
+              R"({"hdf5": {"dataset": {"chunks": )" + chunks + "}}}" } );
+        REQUIRE_THROWS_AS( write.flush(), std::runtime_error );
+    }
+
+    /*
+     * Dataset::extend() leaves the chunk size behind the extent, this must
+     * not count as an explicit chunk size: with chunking disabled, the
+     * filters cannot be applied then.
+     */
+    Dataset extended(
+        Datatype::INT,
+        { 5, 4 },
+        R"({"hdf5": {"dataset": {"filters": [{"type": "shuffle"}]}}})" );
+    extended.extend( { 10, 4 } );
+    REQUIRE( !extended.chunkSizeSpecified );
+    {
+        Series write(
+            name,
+            Access::CREATE,
+            R"({"hdf5": {"dataset": {"chunks": "none"}}})" );
+        auto E_x = write.iterations[ 0 ].meshes[ "E" ][ "x" ];
+        E_x.resetDataset( extended );
+        REQUIRE_THROWS_AS( write.flush(), std::runtime_error );
+    }
+    extended.setChunkSize( { 5, 4 } );
+    REQUIRE( extended.chunkSizeSpecified );
+    {
+        Series write(
+            name,
+            Access::CREATE,
+            R"({"hdf5": {"dataset": {"chunks": "none"}}})" );
+        auto E_x = write.iterations[ 0 ].meshes[ "E" ][ "x" ];
+        E_x.resetDataset( extended );
+        E_x.storeChunk( data, { 0, 0 }, { 10, 4 } );
+        write.flush();
+    }
+}
+
+TEST_CASE( "hdf5_filters", "[serial][hdf5]" )
+{
+    std::vector< int > data( 100000 );
+    for( size_t i = 0; i < data.size(); ++i )
+        data[ i ] = static_cast< int >( i / 100 );
+
+    std::map< std::string, size_t > fileSizes;
+    for( auto const & config :
+         { std::make_pair( "none", "{}" ),
+           std::make_pair(
+               "filters",
+               R"({"hdf5": {"dataset": {"filters": [
+                    {"type": "shuffle"},
+                    {"type": "deflate", "parameters": [1]},
+                    {"type": 3, "optional": true}]}}})" ),
+           std::make_pair( "compression", "{}" ) } )
+    {
+        std::string const name =
+            "../samples/hdf5_filters_" + std::string( config.first ) + ".h5";
+        {
+            Series write( name, Access::CREATE, config.second );
+            auto E_x = write.iterations[ 0 ].meshes[ "E" ][ "x" ];
+            Dataset ds( Datatype::INT, { data.size() } );
+            if( std::string( config.first ) == "compression" )
+                ds.setCompression( "zlib", 1 );
+            E_x.resetDataset( ds );
+            E_x.storeChunk( data, { 0 }, { data.size() } );
+            write.flush();
+        }
+        {
+            Series read( name, Access::READ_ONLY );
+            auto chunk = read.iterations[ 0 ]
+                             .meshes[ "E" ][ "x" ]
+                             .loadChunk< int >();
+            read.flush();
+            REQUIRE( std::equal( data.begin(), data.end(), chunk.get() ) );
+        }
+        std::ifstream file( name, std::ios_base::binary | std::ios_base::ate );
+        fileSizes[ config.first ] = static_cast< size_t >( file.tellg() );
+    }
+    REQUIRE( fileSizes[ "filters" ] * 10 < fileSizes[ "none" ] );
+    REQUIRE( fileSizes[ "compression" ] * 10 < fileSizes[ "none" ] );
+
+    // unknown filter names and filter IDs that are not registered
+    REQUIRE_THROWS_AS(
+        Series(
+            "../samples/hdf5_filters_invalid.h5",
+            Access::CREATE,
+            R"({"hdf5": {"dataset": {"filters": [{"type": "snappy"}]}}})" ),
+        std::runtime_error );
+    for( std::string const options :
+         { R"({"hdf5": {"dataset": {"filters": [{"type": 65000}]}}})",
+           R"({"hdf5": {"dataset": {"chunks": "none",
+                 "filters": [{"type": "deflate", "parameters": [1]}]}}})" } )
+    {
+        Series write( "../samples/hdf5_filters_invalid.h5", Access::CREATE );
+        auto E_x = write.iterations[ 0 ].meshes[ "E" ][ "x" ];
+        E_x.resetDataset( { Datatype::INT, { 10 }, options } );
+        REQUIRE_THROWS_AS( write.flush(), std::runtime_error );
+    }
+
+    // optional filters that are not available are skipped
+    {
+        std::string const name = "../samples/hdf5_filters_optional.h5";
+        {
+            Series write(
+                name,
+                Access::CREATE,
+                R"({"hdf5": {"dataset": {"filters": [
+                    {"type": 65000, "optional": true}]}}})" );
+            auto E_x = write.iterations[ 0 ].meshes[ "E" ][ "x" ];
+            E_x.resetDataset( { Datatype::INT, { data.size() } } );
+            E_x.storeChunk( data, { 0 }, { data.size() } );
+            write.flush();
+        }
+        Series read( name, Access::READ_ONLY );
+        auto chunk =
+            read.iterations[ 0 ].meshes[ "E" ][ "x" ].loadChunk< int >();
+        read.flush();
+        REQUIRE( std::equal( data.begin(), data.end(), chunk.get() ) );
+    }
+
+    // misspelled keys within the filters are reported as unused
+    {
+        std::stringstream warnings;
+        auto const cerr = std::cerr.rdbuf( warnings.rdbuf() );
+        {
+            Series write(
+                "../samples/hdf5_filters_misspelled.h5", Access::CREATE );
+            auto E_x = write.iterations[ 0 ].meshes[ "E" ][ "x" ];
+            E_x.resetDataset(
+                { Datatype::INT,
+                  { 10 },
+                  R"({"hdf5": {"dataset": {"filters": [
+                      {"type": "deflate", "parameters": [1],
+                       "optinal": true}]}}})" } );
+            E_x.storeChunk( data, { 0 }, { 10 } );
+            write.flush();
+        }
+        std::cerr.rdbuf( cerr );
+        REQUIRE(
+            warnings.str().find( R"("optinal":true)" ) != std::string::npos );
+    }
+}
+
+TEST_CASE( "hdf5_direct_chunk_write", "[serial][hdf5]" )
 {
+    // the last row of chunks extends beyond the dataset
+    Extent const extent{ 95, 1000 };
+    std::vector< int > data( extent[ 0 ] * extent[ 1 ] );
+    for( size_t i = 0; i < data.size(); ++i )
+        data[ i ] = static_cast< int >( i / 100 );
+
+    std::string const filters = R"({"hdf5": {"dataset": {
+        "chunks": [10, 100],
+        "filters": [
+            {"type": "shuffle"},
+            {"type": "deflate", "parameters": [1]}]}}})";
+    std::string const shuffle = R"({"hdf5": {"dataset": {
+        "chunks": [10, 100],
+        "filters": [{"type": "shuffle"}]}}})";
+    std::string const direct =
+        R"({"hdf5": {"direct_chunk_write": true, "compression_threads": 4}})";
     /*
-     * This test is HDF5 specific
-     * HDF5 does not store chunks explicitly,
-     * so the HDF5 backend will simply return the whole dataset as one chunk.
-     *
-     * Let's just write some random chunks and show that the HDF5 backend
-     * does not care.
+     * Number of chunks expected to be written via H5Dwrite_chunk: all 100
+     * chunks of E/x, none of E/y.
      */
-    constexpr unsigned height = 10;
-    std::string name = "../samples/available_chunks.h5";
-
-    std::vector< int > data{ 2, 4, 6, 8 };
-    {
-        Series write( name, Access::CREATE );
-        Iteration it0 = write.iterations[ 0 ];
-        auto E_x = it0.meshes[ "E" ][ "x" ];
-        E_x.resetDataset( { Datatype::INT, { height, 4 } } );
-        for( unsigned line = 2; line < 7; ++line )
+#if H5_VERSION_GE(1,10,3)
+    uint64_t const directChunks = 100;
+#else
+    uint64_t const directChunks = 0;
+#endif
+#if openPMD_HAVE_ZLIB
+    uint64_t const directDeflateChunks = directChunks;
+#else
+    uint64_t const directDeflateChunks = 0;
+#endif
+    std::map< std::string, size_t > fileSizes;
+    for( auto const & config :
+         { std::make_tuple( "none", "{}", "{}", uint64_t( 0 ) ),
+           std::make_tuple( "filters", "{}", filters.c_str(), uint64_t( 0 ) ),
+           std::make_tuple(
+               "direct", direct.c_str(), filters.c_str(), directDeflateChunks ),
+           std::make_tuple(
+               "direct_shuffle", direct.c_str(), shuffle.c_str(), directChunks ),
+           // contiguous datasets are always written via H5Dwrite
+           std::make_tuple(
+               "direct_unfiltered",
+               direct.c_str(),
+               R"({"hdf5": {"dataset": {"chunks": "none"}}})",
+               uint64_t( 0 ) ) } )
+    {
+        std::string const name = "../samples/hdf5_direct_chunk_write_" +
+            std::string( std::get< 0 >( config ) ) + ".h5";
         {
-            E_x.storeChunk( data, { line, 0 }, { 1, 4 } );
+            Series write( name, Access::CREATE, std::get< 1 >( config ) );
+            auto E = write.iterations[ 0 ].meshes[ "E" ];
+            Dataset ds( Datatype::INT, extent, std::get< 2 >( config ) );
+            // aligned with the chunks, written directly
+            E[ "x" ].resetDataset( ds );
+            E[ "x" ].storeChunk(
+                shareRaw( data.data() ), { 0, 0 }, { 50, 1000 } );
+            E[ "x" ].storeChunk(
+                shareRaw( data.data() + 50 * 1000 ), { 50, 0 }, { 45, 1000 } );
+            // not aligned, falls back to H5Dwrite
+            E[ "y" ].resetDataset( ds );
+            for( auto const & columns :
+                 { std::make_pair( 0u, 550u ), std::make_pair( 550u, 450u ) } )
+            {
+                std::shared_ptr< int > block(
+                    new int[ extent[ 0 ] * columns.second ],
+                    []( int const * p ) { delete[] p; } );
+                for( size_t i = 0; i < extent[ 0 ]; ++i )
+                    std::copy_n(
+                        data.begin() + i * extent[ 1 ] + columns.first,
+                        columns.second,
+                        block.get() + i * columns.second );
+                E[ "y" ].storeChunk(
+                    block, { 0, columns.first }, { extent[ 0 ], columns.second } );
+            }
+            write.flush();
+            REQUIRE(
+                write.ioStatistics().counter( "hdf5.direct_chunk_writes" ) ==
+                std::get< 3 >( config ) );
         }
-        for( unsigned line = 7; line < 9; ++line )
         {
-            E_x.storeChunk( data, { line, 0 }, { 1, 2 } );
+            Series read( name, Access::READ_ONLY );
+            auto E = read.iterations[ 0 ].meshes[ "E" ];
+            auto x = E[ "x" ].loadChunk< int >();
+            auto y = E[ "y" ].loadChunk< int >();
+            auto block = E[ "x" ].loadChunk< int >( { 45, 250 }, { 20, 300 } );
+            read.flush();
+            REQUIRE( std::equal( data.begin(), data.end(), x.get() ) );
+            REQUIRE( std::equal( data.begin(), data.end(), y.get() ) );
+            for( size_t i = 0; i < 20; ++i )
+                REQUIRE( std::equal(
+                    block.get() + i * 300,
+                    block.get() + ( i + 1 ) * 300,
+                    data.begin() + ( 45 + i ) * 1000 + 250 ) );
         }
-        E_x.storeChunk( data, { 8, 3 }, {2, 1 } );
-        it0.close();
-    }
-
-    {
-        Series read( name, Access::READ_ONLY );
-        Iteration it0 = read.iterations[ 0 ];
-        auto E_x = it0.meshes[ "E" ][ "x" ];
-        ChunkTable table = E_x.availableChunks();
-        REQUIRE( table.size() == 1 );
-        /*
-         * Explicitly convert things to bool, so Catch doesn't get the splendid
-         * idea to print the Chunk struct.
-         */
-        REQUIRE(
-            bool( table[ 0 ] == WrittenChunkInfo( { 0, 0 }, { height, 4 } ) ) );
+        std::ifstream file( name, std::ios_base::binary | std::ios_base::ate );
+        fileSizes[ std::get< 0 >( config ) ] =
+            static_cast< size_t >( file.tellg() );
     }
+    REQUIRE( fileSizes[ "direct" ] * 10 < fileSizes[ "none" ] );
+    REQUIRE( fileSizes[ "direct" ] == fileSizes[ "filters" ] );
 }
 
 TEST_CASE( "optional_paths_110_test", "[serial]" )
@@ -4348,3 +5548,599 @@ TEST_CASE( "no_explicit_flush", "[serial]" )
         no_explicit_flush( "../samples/no_explicit_flush." + t );
     }
 }
+
+void asynchronous_flush( std::string const & filename )
+{
+    std::string const jsonConfig = R"({"asynchronous_flush": true})";
+    constexpr size_t length = 100;
+    {
+        Series series( filename, Access::CREATE, jsonConfig );
+        for( uint64_t i = 0; i < 5; ++i )
+        {
+            auto iteration = series.iterations[ i ];
+            iteration.setAttribute( "step", i );
+            auto E_x = iteration.meshes[ "E" ][ "x" ];
+            E_x.resetDataset( { Datatype::DOUBLE, { length } } );
+            // the library keeps the buffer alive until written
+            auto buffer = std::shared_ptr< double >(
+                new double[ length ], []( double * p ) { delete[] p; } );
+            for( size_t j = 0; j < length; ++j )
+                buffer.get()[ j ] = double( i * length + j );
+            E_x.storeChunk( buffer, { 0 }, { length } );
+            series.flush();
+            iteration.close();
+        }
+
+        // a buffer may be reused once the returned future is ready
+        std::vector< double > reused( length );
+        for( uint64_t i = 5; i < 8; ++i )
+        {
+            auto iteration = series.iterations[ i ];
+            iteration.setAttribute( "step", i );
+            auto E_x = iteration.meshes[ "E" ][ "x" ];
+            E_x.resetDataset( { Datatype::DOUBLE, { length } } );
+            for( size_t j = 0; j < length; ++j )
+                reused[ j ] = double( i * length + j );
+            E_x.storeChunk( shareRaw( reused ), { 0 }, { length } );
+            auto written = series.flushAsync();
+            REQUIRE( written.valid() );
+            written.get();
+        }
+    }
+    {
+        Series series( filename, Access::READ_ONLY );
+        REQUIRE( series.iterations.size() == 8 );
+        for( auto & entry : series.iterations )
+        {
+            uint64_t const i = entry.first;
+            REQUIRE(
+                entry.second.getAttribute( "step" ).get< uint64_t >() == i );
+            auto E_x = entry.second.meshes[ "E" ][ "x" ];
+            auto data = E_x.loadChunk< double >( { 0 }, { length } );
+            entry.second.close();
+            for( size_t j = 0; j < length; ++j )
+                REQUIRE( data.get()[ j ] == double( i * length + j ) );
+        }
+    }
+}
+
+void asynchronous_flush_error()
+{
+    std::string const directory = "../samples/asynchronous_flush_error/";
+    constexpr size_t length = 10;
+    auxiliary::create_directories( directory );
+    Series series(
+        directory + "data.json",
+        Access::CREATE,
+        R"({"asynchronous_flush": true})" );
+    auto E_x = series.iterations[ 0 ].meshes[ "E" ][ "x" ];
+    E_x.resetDataset( { Datatype::DOUBLE, { length } } );
+    std::vector< double > data( length, 1. );
+    E_x.storeChunk( shareRaw( data ), { 0 }, { length } );
+    series.flush();
+    series.flush();
+
+    // writing the file in the background fails without the directory
+    auxiliary::remove_directory( directory );
+    E_x.storeChunk( shareRaw( data ), { 0 }, { length } );
+    auto written = series.flushAsync();
+    REQUIRE_THROWS_WITH(
+        written.get(), Catch::Equals( "[JSON] Failed opening a file" ) );
+    // the future has reported the error, the next flush must not again
+    auxiliary::create_directories( directory );
+    REQUIRE_NOTHROW( series.flush() );
+
+    // without a future to consume it, the next flush reports the error
+    auxiliary::remove_directory( directory );
+    E_x.storeChunk( shareRaw( data ), { 0 }, { length } );
+    series.flush();
+    REQUIRE_THROWS_WITH(
+        series.flush(), Catch::Equals( "[JSON] Failed opening a file" ) );
+    auxiliary::create_directories( directory );
+    REQUIRE_NOTHROW( series.flush() );
+}
+
+TEST_CASE( "asynchronous_flush", "[serial]" )
+{
+    for( auto const & t : testedFileExtensions() )
+    {
+        asynchronous_flush( "../samples/asynchronous_flush." + t );
+        asynchronous_flush( "../samples/asynchronous_flush_%T." + t );
+    }
+    asynchronous_flush_error();
+}
+
+void rowwise_chunks( std::string const & extension )
+{
+    std::string const filename = "../samples/rowwise_chunks." + extension;
+    constexpr uint64_t rows = 16, cols = 5;
+    {
+        Series series( filename, Access::CREATE );
+        auto E_x = series.iterations[ 0 ].meshes[ "E" ][ "x" ];
+        E_x.resetDataset( { Datatype::FLOAT, { rows, cols } } );
+        for( uint64_t row = 0; row < rows; ++row )
+        {
+            std::shared_ptr< float > data{
+                new float[ cols ], []( float * p ) { delete[] p; } };
+            std::iota( data.get(), data.get() + cols, float( row * cols ) );
+            E_x.storeChunk( data, { row, 0 }, { 1, cols } );
+        }
+        series.flush();
+    }
+    {
+        Series series( filename, Access::READ_ONLY );
+        auto E_x = series.iterations[ 0 ].meshes[ "E" ][ "x" ];
+        std::vector< std::shared_ptr< float > > chunks;
+        for( uint64_t row = 0; row < rows; ++row )
+        {
+            for( uint64_t col = 0; col < cols; ++col )
+                chunks.push_back( E_x.loadChunk< float >( { row, col }, { 1, 1 } ) );
+        }
+        series.flush();
+        for( uint64_t i = 0; i < rows * cols; ++i )
+            REQUIRE( *chunks[ i ] == float( i ) );
+    }
+}
+
+TEST_CASE( "rowwise_chunks", "[serial]" )
+{
+    for( auto const & t : testedFileExtensions() )
+    {
+        rowwise_chunks( t );
+    }
+}
+
+void io_statistics( std::string const & extension, bool asynchronous )
+{
+    std::string const filename = "../samples/io_statistics." + extension;
+    std::string const statisticsFile = "../samples/io_statistics_dump.json";
+    std::string const jsonConfig = std::string( R"({"statistics_file": ")" ) +
+        statisticsFile + R"(", "asynchronous_flush": )" +
+        ( asynchronous ? "true" : "false" ) + "}";
+    constexpr uint64_t length = 10;
+    {
+        Series series( filename, Access::CREATE, jsonConfig );
+        for( uint64_t i = 0; i < 3; ++i )
+        {
+            auto E_x = series.iterations[ i ].meshes[ "E" ][ "x" ];
+            E_x.resetDataset( { Datatype::DOUBLE, { length } } );
+            std::shared_ptr< double > data{
+                new double[ length ], []( double * p ) { delete[] p; } };
+            std::iota( data.get(), data.get() + length, 0. );
+            E_x.storeChunk( data, { 0 }, { length } );
+        }
+        series.flush();
+
+        IOStatistics stats = series.ioStatistics();
+        REQUIRE( stats[ Operation::CREATE_DATASET ].count == 3 );
+        REQUIRE( stats[ Operation::WRITE_DATASET ].count == 3 );
+        REQUIRE(
+            stats[ Operation::WRITE_DATASET ].bytes ==
+            3 * length * sizeof( double ) );
+        REQUIRE( stats[ Operation::WRITE_ATT ].count > 0 );
+        REQUIRE( stats[ Operation::WRITE_ATT ].bytes == 0 );
+        REQUIRE( stats[ Operation::READ_DATASET ].count == 0 );
+        REQUIRE( stats.total().bytes == 3 * length * sizeof( double ) );
+        REQUIRE(
+            stats.total().count >= stats[ Operation::WRITE_ATT ].count + 6 );
+    }
+
+    std::ifstream dump( statisticsFile );
+    REQUIRE( dump.good() );
+    std::string content{
+        std::istreambuf_iterator< char >( dump ),
+        std::istreambuf_iterator< char >() };
+    REQUIRE( content.find( "\"WRITE_DATASET\"" ) != std::string::npos );
+    REQUIRE( content.find( "\"READ_DATASET\"" ) == std::string::npos );
+
+    {
+        Series series( filename, Access::READ_ONLY );
+        auto E_x = series.iterations[ 2 ].meshes[ "E" ][ "x" ];
+        auto data = E_x.loadChunk< double >();
+        series.flush();
+        IOStatistics stats = series.ioStatistics();
+        REQUIRE( stats[ Operation::READ_DATASET ].count == 1 );
+        REQUIRE(
+            stats[ Operation::READ_DATASET ].bytes ==
+            length * sizeof( double ) );
+        REQUIRE( stats[ Operation::WRITE_DATASET ].count == 0 );
+        REQUIRE( data.get()[ length - 1 ] == double( length - 1 ) );
+    }
+}
+
+TEST_CASE( "io_statistics", "[serial]" )
+{
+    for( auto const & t : testedFileExtensions() )
+    {
+        io_statistics( t, false );
+        io_statistics( t, true );
+    }
+    REQUIRE_THROWS_AS(
+        Series(
+            "../samples/io_statistics.json",
+            Access::CREATE,
+            R"({"statistics_file": 1})" ),
+        std::runtime_error );
+}
+
+void io_trace( std::string const & extension )
+{
+    std::string const filename = "../samples/io_trace." + extension;
+    std::string const traceFile = "../samples/io_trace_" + extension + ".json";
+    {
+        Series series(
+            filename,
+            Access::CREATE,
+            R"({"trace_file": ")" + traceFile + R"("})" );
+        auto iteration = series.iterations[ 0 ];
+        auto E_x = iteration.meshes[ "E" ][ "x" ];
+        E_x.resetDataset( { Datatype::INT, { 2, 5 } } );
+        std::shared_ptr< int > data{
+            new int[ 10 ], []( int * p ) { delete[] p; } };
+        std::iota( data.get(), data.get() + 10, 0 );
+        E_x.storeChunk( data, { 0, 0 }, { 2, 5 } );
+        series.flush();
+        iteration.close();
+    }
+
+    std::ifstream trace( traceFile );
+    REQUIRE( trace.good() );
+    std::string content{
+        std::istreambuf_iterator< char >( trace ),
+        std::istreambuf_iterator< char >() };
+    REQUIRE( content.find( "\"traceEvents\"" ) != std::string::npos );
+    REQUIRE( content.find( "\"Series::flush\"" ) != std::string::npos );
+    REQUIRE( content.find( "\"Iteration::close\"" ) != std::string::npos );
+    REQUIRE( content.find( "\"WRITE_DATASET\"" ) != std::string::npos );
+    REQUIRE(
+        content.find( "\"/iterations/0/meshes/E/x\"" ) != std::string::npos );
+    REQUIRE( content.find( "\"[2, 5]\"" ) != std::string::npos );
+}
+
+TEST_CASE( "io_trace", "[serial]" )
+{
+    for( auto const & t : testedFileExtensions() )
+    {
+        io_trace( t );
+    }
+}
+
+void bulk_attribute_read( std::string const & extension )
+{
+    std::string const filename = "../samples/bulk_attribute_read." + extension;
+    {
+        Series series( filename, Access::CREATE );
+        series.setAttribute( "custom", "series" );
+        auto iteration = series.iterations[ 100 ];
+        iteration.setTime( 2.5 );
+        auto E = iteration.meshes[ "E" ];
+        E.setAttribute( "custom", 42 );
+        for( auto const & component : { "x", "y" } )
+        {
+            E[ component ].resetDataset( { Datatype::DOUBLE, { 4 } } );
+            E[ component ].makeConstant( 1. );
+        }
+        auto rho = iteration.meshes[ "rho" ][ MeshRecordComponent::SCALAR ];
+        rho.resetDataset( { Datatype::FLOAT, { 4 } } );
+        rho.makeConstant( 2.f );
+        auto position = iteration.particles[ "e" ][ "position" ];
+        position.setUnitDimension( { { UnitDimension::L, 1 } } );
+        position[ "x" ].resetDataset( { Datatype::INT, { 3 } } );
+        position[ "x" ].makeConstant( 3 );
+    }
+
+    {
+        Series series( filename, Access::READ_ONLY );
+        IOStatistics stats = series.ioStatistics();
+        // every object is parsed with a single READ_ATTS task
+        REQUIRE( stats[ Operation::READ_ATT ].count == 0 );
+        REQUIRE( stats[ Operation::READ_ATTS ].count > 0 );
+        REQUIRE( stats[ Operation::LIST_ATTS ].count == 0 );
+
+        REQUIRE(
+            series.getAttribute( "custom" ).get< std::string >() == "series" );
+        auto iteration = series.iterations[ 100 ];
+        REQUIRE( iteration.time< double >() == 2.5 );
+        auto E = iteration.meshes[ "E" ];
+        REQUIRE( E.getAttribute( "custom" ).get< int >() == 42 );
+        REQUIRE( E[ "x" ].constant() );
+        REQUIRE( E[ "y" ].getAttribute( "value" ).get< double >() == 1. );
+        auto rho = iteration.meshes[ "rho" ];
+        REQUIRE( rho.scalar() );
+        REQUIRE(
+            rho[ MeshRecordComponent::SCALAR ]
+                .getAttribute( "value" )
+                .get< float >() == 2.f );
+        auto position = iteration.particles[ "e" ][ "position" ];
+        REQUIRE( position.unitDimension()[ 0 ] == 1. );
+        REQUIRE( position[ "x" ].getAttribute( "value" ).get< int >() == 3 );
+    }
+
+    // modified and deleted attributes must not be served from a prefetch
+    {
+        Series rw( filename, Access::READ_WRITE );
+        auto rwE = rw.iterations[ 100 ].meshes[ "E" ];
+        REQUIRE( rwE.getAttribute( "custom" ).get< int >() == 42 );
+        rwE.setAttribute( "custom", 43 );
+        rw.flush();
+        rwE.setAttribute( "other", "value" );
+        rw.flush();
+        REQUIRE( rwE.deleteAttribute( "other" ) );
+    }
+    {
+        Series reread( filename, Access::READ_ONLY );
+        auto rereadE = reread.iterations[ 100 ].meshes[ "E" ];
+        REQUIRE( rereadE.getAttribute( "custom" ).get< int >() == 43 );
+        REQUIRE( !rereadE.containsAttribute( "other" ) );
+    }
+}
+
+TEST_CASE( "bulk_attribute_read", "[serial]" )
+{
+    for( auto const & t : testedFileExtensions() )
+    {
+        bulk_attribute_read( t );
+    }
+}
+
+void dirty_attributes( std::string const & filename )
+{
+    {
+        Series series( filename, Access::CREATE );
+        auto iteration = series.iterations[ 0 ];
+        auto E_x = iteration.meshes[ "E" ][ "x" ];
+        E_x.resetDataset( { Datatype::DOUBLE, { 10 } } );
+        E_x.makeConstant( 1. );
+        series.flush();
+
+        auto writtenAttributes = [ &series ]() {
+            return series.ioStatistics()[ Operation::WRITE_ATT ].count;
+        };
+        auto const initial = writtenAttributes();
+        REQUIRE( initial > 10 );
+
+        // nothing modified, nothing written
+        series.flush();
+        REQUIRE( writtenAttributes() == initial );
+
+        // only the modified attributes are written
+        iteration.setTime( 0.5 );
+        series.flush();
+        REQUIRE( writtenAttributes() == initial + 1 );
+
+        E_x.setUnitSI( 2. );
+        E_x.setAttribute( "custom", "value" );
+        iteration.meshes[ "E" ].setGridUnitSI( 3. );
+        series.flush();
+        REQUIRE( writtenAttributes() == initial + 4 );
+    }
+    {
+        Series series( filename, Access::READ_ONLY );
+        auto iteration = series.iterations[ 0 ];
+        REQUIRE( iteration.time< double >() == 0.5 );
+        auto E = iteration.meshes[ "E" ];
+        REQUIRE( E.gridUnitSI() == 3. );
+        REQUIRE( E[ "x" ].unitSI() == 2. );
+        REQUIRE(
+            E[ "x" ].getAttribute( "custom" ).get< std::string >() ==
+            "value" );
+    }
+}
+
+TEST_CASE( "dirty_attributes", "[serial]" )
+{
+    for( auto const & t : testedFileExtensions() )
+    {
+        dirty_attributes( "../samples/dirty_attributes." + t );
+    }
+}
+
+void active_iterations( std::string const & filename )
+{
+    {
+        Series series( filename, Access::CREATE );
+        auto longLived = series.iterations[ 0 ];
+        longLived.setAttribute( "step", 0 );
+        auto rho = longLived.meshes[ "rho" ][ MeshRecordComponent::SCALAR ];
+        rho.resetDataset( { Datatype::DOUBLE, { 5 } } );
+        rho.makeConstant( 1. );
+        for( uint64_t i = 1; i < 10; ++i )
+        {
+            auto iteration = series.iterations[ i ];
+            iteration.setAttribute( "step", static_cast< int >( i ) );
+            iteration.meshes[ "rho" ][ MeshRecordComponent::SCALAR ]
+                .resetDataset( { Datatype::DOUBLE, { 5 } } );
+            iteration.meshes[ "rho" ][ MeshRecordComponent::SCALAR ]
+                .makeConstant( 1. );
+            iteration.close();
+        }
+        series.flush();
+
+        // still open, so the next flush must find it
+        longLived.setAttribute( "late", 1 );
+        rho.setUnitSI( 2. );
+        series.flush();
+
+        // iterations that are erased before being flushed are skipped
+        series.iterations[ 10 ];
+        series.iterations.erase( 10 );
+        series.flush();
+    }
+    {
+        Series series( filename, Access::READ_ONLY );
+        REQUIRE( series.iterations.size() == 10 );
+        auto iteration = series.iterations[ 0 ];
+        REQUIRE( iteration.getAttribute( "late" ).get< int >() == 1 );
+        REQUIRE(
+            iteration.meshes[ "rho" ][ MeshRecordComponent::SCALAR ]
+                .unitSI() == 2. );
+        REQUIRE(
+            series.iterations[ 9 ].getAttribute( "step" ).get< int >() == 9 );
+    }
+}
+
+void active_iterations_relinked( std::string const & filename )
+{
+    Series series( filename, Access::CREATE );
+    auto first = series.iterations[ 0 ];
+    auto E = first.meshes[ "E" ];
+    auto E_x = E[ "x" ];
+    // resolves the enclosing iteration of E_x
+    E_x.resetDataset( { Datatype::INT, { 5 } } );
+    E_x.makeConstant( 0 );
+    first.meshes.erase( "E" );
+
+    auto second = series.iterations[ 1 ];
+    second.meshes[ "rho" ][ MeshRecordComponent::SCALAR ].resetDataset(
+        { Datatype::INT, { 5 } } );
+    second.meshes[ "rho" ][ MeshRecordComponent::SCALAR ].makeConstant( 1 );
+    second.close();
+
+    // move E into the closed iteration, its components must follow
+    test::TestHelper::linkHierarchy( E, second.meshes );
+    second.meshes.emplace( "E", E );
+    E_x.setAttribute( "late", 1 );
+    REQUIRE_THROWS_WITH(
+        series.flush(),
+        Catch::Equals( "[Series] Detected illegal access to iteration that "
+                       "has been closed previously." ) );
+}
+
+void active_iterations_outlived( std::string const & filename )
+{
+    std::unique_ptr< MeshRecordComponent > rho;
+    {
+        Series series( filename, Access::CREATE );
+        rho.reset( new MeshRecordComponent(
+            series.iterations[ 0 ].meshes[ "rho" ]
+                                   [ MeshRecordComponent::SCALAR ] ) );
+        rho->resetDataset( { Datatype::INT, { 5 } } );
+        rho->makeConstant( 1 );
+    }
+    // the Series is gone, modifications must not look for it
+    rho->setAttribute( "late", 1 );
+    rho->setUnitSI( 2. );
+}
+
+TEST_CASE( "active_iterations", "[serial]" )
+{
+    for( auto const & t : testedFileExtensions() )
+    {
+        active_iterations( "../samples/active_iterations." + t );
+        active_iterations_relinked(
+            "../samples/active_iterations_relinked_%T." + t );
+        active_iterations_outlived(
+            "../samples/active_iterations_outlived." + t );
+    }
+}
+
+#if openPMD_HAVE_HDF5
+TEST_CASE( "series_flush_benchmark", "[.benchmark]" )
+{
+    constexpr uint64_t numIterations = 100000;
+    using Clock = std::chrono::steady_clock;
+    Series series(
+        "../samples/series_flush_benchmark.h5", Access::CREATE );
+
+    // time of a flush of the whole Series with one open iteration
+    auto timeFlush = [ &series ]( uint64_t index ) {
+        series.iterations[ index ].setAttribute( "step", index );
+        auto const start = Clock::now();
+        series.flush();
+        auto const end = Clock::now();
+        return std::chrono::duration_cast< std::chrono::microseconds >(
+                   end - start )
+            .count();
+    };
+
+    for( uint64_t i = 0; i < numIterations; ++i )
+    {
+        if( i == 10 || i == 1000 || i == numIterations - 1 )
+        {
+            std::cout << "[series_flush_benchmark] us per Series::flush() "
+                         "after "
+                      << i << " closed iterations: " << timeFlush( i )
+                      << std::endl;
+        }
+        series.iterations[ i ].setAttribute( "step", i );
+        series.iterations[ i ].close();
+    }
+}
+#endif
+
+void parsing_threads( std::string const & ext )
+{
+    std::string const name = "../samples/parsing_threads/data%T." + ext;
+    constexpr uint64_t numIterations = 20;
+    {
+        Series series( name, Access::CREATE );
+        for( uint64_t i = 0; i < numIterations; ++i )
+        {
+            auto E_x = series.iterations[ i ].meshes[ "E" ][ "x" ];
+            E_x.resetDataset( { determineDatatype< uint64_t >(), { 3 } } );
+            std::shared_ptr< uint64_t > data{
+                new uint64_t[ 3 ]{ i, i + 1, i + 2 },
+                []( uint64_t const * p ) { delete[] p; } };
+            E_x.storeChunk( data, { 0 }, { 3 } );
+            series.iterations[ i ].close();
+        }
+    }
+    {
+        Series series( name, Access::READ_ONLY, R"({"parsing_threads": 4})" );
+        REQUIRE( series.iterations.size() == numIterations );
+        for( auto & iteration : series.iterations )
+        {
+            auto E_x = iteration.second.meshes[ "E" ][ "x" ];
+            REQUIRE( E_x.getExtent() == Extent{ 3 } );
+            auto chunk = E_x.loadChunk< uint64_t >();
+            iteration.second.close();
+            REQUIRE( chunk.get()[ 2 ] == iteration.first + 2 );
+        }
+    }
+}
+
+TEST_CASE( "parsing_threads", "[serial]" )
+{
+    for( auto const & t : testedFileExtensions() )
+    {
+        parsing_threads( t );
+    }
+}
+
+TEST_CASE( "parsing_threads_benchmark", "[.benchmark]" )
+{
+    std::string const name = "../samples/parsing_threads_benchmark/data%T.json";
+    constexpr uint64_t numIterations = 500;
+    constexpr size_t extent = 20000;
+    {
+        Series series( name, Access::CREATE );
+        std::vector< double > data( extent, 1.5 );
+        for( uint64_t i = 0; i < numIterations; ++i )
+        {
+            auto E_x = series.iterations[ i ].meshes[ "E" ][ "x" ];
+            E_x.resetDataset( { Datatype::DOUBLE, { extent } } );
+            E_x.storeChunk( data, { 0 }, { extent } );
+            series.iterations[ i ].close();
+        }
+    }
+
+    auto millisecondsToOpen = [ & ]( unsigned threads ) {
+        using Clock = std::chrono::steady_clock;
+        auto const start = Clock::now();
+        Series series(
+            name,
+            Access::READ_ONLY,
+            "{\"parsing_threads\": " + std::to_string( threads ) + "}" );
+        auto const end = Clock::now();
+        REQUIRE( series.iterations.size() == numIterations );
+        return std::chrono::duration_cast< std::chrono::milliseconds >(
+                   end - start )
+            .count();
+    };
+    unsigned const cores = std::max( std::thread::hardware_concurrency(), 1u );
+    auto const sequential = millisecondsToOpen( 1 );
+    auto const parallel = millisecondsToOpen( cores );
+    std::cout << "[parsing_threads_benchmark] ms to open " << numIterations
+              << " JSON files: sequential " << sequential << ", " << cores
+              << " threads " << parallel << std::endl;
+}